@@ -1,3 +1,90 @@
+newoption {
+	trigger = "avx2",
+	description = "Build the vectorized kernels with AVX2 (the machine running NucKage must support AVX2)"
+}
+
+--Nuclear masses are compiled in: src/MassTable.h is generated from the AMDC mass file etc/mass.txt whenever the
+--project files are generated. The file is only rewritten when the table changes, so a rerun does not force a rebuild.
+local function GenerateMassTable(inputName, outputName)
+	local input = io.open(inputName, "r")
+	if input == nil then
+		error("Unable to open mass file " .. inputName)
+	end
+
+	local entries = {}
+	local maxZ = 0
+	local maxA = 0
+	local lineNumber = 0
+	for line in input:lines() do
+		lineNumber = lineNumber + 1
+		--two header lines, then N Z A element mass (integer part in u, remainder in micro-u)
+		if lineNumber > 2 then
+			local n, z, a, element, big, small = line:match("^%s*(%d+)%s+(%d+)%s+(%d+)%s+(%a+)%s+(%d+)%s+([%d%.]+)")
+			if n ~= nil then
+				--no leading zeros in the literal
+				small = small:gsub("^0+(%d)", "%1")
+				table.insert(entries, string.format("\t\t\t{%s, %s, \"%s\", %s, %s},", z, a, element, big, small))
+				maxZ = math.max(maxZ, tonumber(z))
+				maxA = math.max(maxA, tonumber(a))
+			end
+		end
+	end
+	input:close()
+
+	local text = table.concat({
+		"/*",
+		"",
+		"MassTable.h",
+		"Generated from etc/mass.txt by premake5.lua, do not edit. Atomic masses from the AMDC, as in the mass file: the",
+		"integer part in u and the remainder in micro-u. Used by MassLookup to build its table at compile time.",
+		"",
+		"*/",
+		"#ifndef MASS_TABLE_H",
+		"#define MASS_TABLE_H",
+		"",
+		"namespace NucKage {",
+		"",
+		"\tnamespace MassTable {",
+		"",
+		"\t\tstruct Entry",
+		"\t\t{",
+		"\t\t\tint Z;",
+		"\t\t\tint A;",
+		"\t\t\tconst char* element;",
+		"\t\t\tdouble atomicMassBig; //u",
+		"\t\t\tdouble atomicMassSmall; //micro-u",
+		"\t\t};",
+		"",
+		string.format("\t\tconstexpr int maxZ = %d;", maxZ),
+		string.format("\t\tconstexpr int maxA = %d;", maxA),
+		"",
+		"\t\tconstexpr Entry entries[] = {",
+		table.concat(entries, "\n"),
+		"\t\t};",
+		"\t}",
+		"",
+		"}",
+		"",
+		"#endif",
+		""
+	}, "\n")
+
+	local previous = io.open(outputName, "r")
+	if previous ~= nil then
+		local previousText = previous:read("*a")
+		previous:close()
+		if previousText == text then
+			return
+		end
+	end
+
+	local output = io.open(outputName, "w")
+	output:write(text)
+	output:close()
+end
+
+GenerateMassTable(path.join(_SCRIPT_DIR, "etc/mass.txt"), path.join(_SCRIPT_DIR, "src/MassTable.h"))
+
 workspace "NucKage"
 	configurations {
 		"Release",
@@ -45,6 +132,11 @@ project "NucKage"
 			"-pthread"
 		}
 
+	filter "options:avx2"
+		buildoptions {
+			"-mavx2"
+		}
+
 	filter "configurations:Debug"
 		symbols "On"
 
@@ -1,5 +1,6 @@
 #include "DetectorArray.h"
 #include <fstream>
+#include <algorithm>
 
 namespace NucKage {
 
@@ -16,44 +17,38 @@ namespace NucKage {
 		m_sabre.emplace_back(SabreDetector::Parameters(90.0, 40.0, -0.1245, draw, 4));
 	}
 
-	void DetectorArray::ProcessData(ChainResult& data)
+	//Ejectiles of every reactor and the residual of the last reactor
+	void DetectorArray::ProcessBatch(EventBlock& block)
 	{
-		for(int i=0; i<(data.products.size() -1); i++)
+		if(block.reactors.empty())
+			return;
+
+		for(auto& reactor : block.reactors)
 		{
-			Nucleus& particle = data.products[i].ejectile;
-			m_focalPlane.CheckNucleus(particle);
-			if(particle.detected)
-				continue;
-			
-			for(auto& sabdet : m_sabre)
-			{
-				sabdet.CheckNucleus(particle);
-				if(particle.detected)
-					break;
-			}
+			for(auto& particles : reactor.particles)
+				std::fill(particles.detected.begin(), particles.detected.begin() + block.size, 0);
 		}
 
-		//Last reaction in the chain look at both residual and ejectile
-
-		Nucleus& eject = data.products[data.products.size()-1].ejectile;
-		m_focalPlane.CheckNucleus(eject);
-		if(!eject.detected)
+		for(auto& reactor : block.reactors)
 		{
-			for(auto& sabdet : m_sabre)
-			{
-				sabdet.CheckNucleus(eject);
-				if(eject.detected)
-					break;
-			}
+			CheckParticles(reactor.particles[ReactorColumns::Ejectile], reactor.info[ReactorColumns::Ejectile].Z, reactor.valid, block.size);
 		}
-		Nucleus& resid = data.products[data.products.size()-1].residual;
-		m_focalPlane.CheckNucleus(resid);
-		if(!resid.detected)
+
+		ReactorColumns& last = block.reactors.back();
+		CheckParticles(last.particles[ReactorColumns::Residual], last.info[ReactorColumns::Residual].Z, last.valid, block.size);
+	}
+
+	void DetectorArray::CheckParticles(ParticleColumns& particles, int Z, const std::vector<uint8_t>& valid, size_t n)
+	{
+		for(size_t i=0; i<n; i++)
 		{
+			if(!valid[i])
+				continue;
+			if(m_focalPlane.CheckParticle(particles, i, Z))
+				continue;
 			for(auto& sabdet : m_sabre)
 			{
-				sabdet.CheckNucleus(resid);
-				if(resid.detected)
+				if(sabdet.CheckParticle(particles, i))
 					break;
 			}
 		}
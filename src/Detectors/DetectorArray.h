@@ -16,12 +16,14 @@ namespace NucKage {
 		inline void SetFocalPlane(const FocalPlaneDetector::Parameters& params) { m_focalPlane.SetParameters(params); }
 		void SetSabre(bool draw); //SABRE is always SABRE, no user input. Simply turn it on or off.
 
-		void ProcessData(ChainResult& data);
+		void ProcessBatch(EventBlock& block);
 		void MakeSabreFile(const std::string& name);
 		void TestSabre();
 		inline double GetFPSolidAngle() { return m_focalPlane.CalculateSolidAngle(); }
 
 	private:
+		void CheckParticles(ParticleColumns& particles, int Z, const std::vector<uint8_t>& valid, size_t n);
+
 		static constexpr double s_deg2rad = M_PI/180.0;
 		std::vector<SabreDetector> m_sabre;
 		FocalPlaneDetector m_focalPlane;
@@ -4,13 +4,13 @@
 namespace NucKage {
 
 	FocalPlaneDetector::FocalPlaneDetector() :
-		m_bfield(0.0), m_angle(0.0)
+		m_bfield(0.0), m_angle(0.0), m_nameID(NameTable::GetInstance().Intern(NameKind::Detector, "FocalPlane"))
 	{
 		m_spsRotation.RotateY(0.0);
 	}
 
 	FocalPlaneDetector::FocalPlaneDetector(const Parameters& params) :
-		m_bfield(params.bfield), m_angle(params.angle)
+		m_bfield(params.bfield), m_angle(params.angle), m_nameID(NameTable::GetInstance().Intern(NameKind::Detector, "FocalPlane"))
 	{
 		m_spsRotation.RotateY(-params.angle); //rotate back to SPS 0 deg (90 deg in x-z plane)
 	}
@@ -71,7 +71,7 @@ namespace NucKage {
 		if(!PassesAperture(nucleus.pvector.Theta(), nucleus.pvector.Phi()))
 		{
 			nucleus.detected = false;
-			nucleus.detectorName = "";
+			nucleus.detectorName = NameTable::s_noName;
 			return;
 		}
 
@@ -79,15 +79,34 @@ namespace NucKage {
 		if(rho < s_rhoMin || rho > s_rhoMax)
 		{
 			nucleus.detected = false;
-			nucleus.detectorName = "";
+			nucleus.detectorName = NameTable::s_noName;
 			return;
 		}
 
 		nucleus.detected = true;
-		nucleus.detectorName = "FocalPlane";
+		nucleus.detectorName = m_nameID;
 		nucleus.detectorID = s_detectorID;
 		nucleus.detectorFrontChannel = -1;
 		nucleus.detectorBackChannel = -1;
 		nucleus.rho = rho;
 	}
+
+	//Column version of CheckNucleus, returns whether the particle was detected
+	bool FocalPlaneDetector::CheckParticle(ParticleColumns& particles, size_t index, int Z)
+	{
+		particles.detected[index] = 0;
+		if(!PassesAperture(particles.Theta(index), particles.Phi(index)))
+			return false;
+
+		double rho = particles.P(index)/(s_qbrho2p*m_bfield*Z);
+		if(rho < s_rhoMin || rho > s_rhoMax)
+			return false;
+
+		particles.detected[index] = 1;
+		particles.detectorID[index] = s_detectorID;
+		particles.detectorFrontChannel[index] = -1;
+		particles.detectorBackChannel[index] = -1;
+		particles.rho[index] = rho;
+		return true;
+	}
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define FOCAL_PLANE_DETECTOR_H
 
 #include "Nucleus.h"
+#include "EventBlock.h"
 #include "TRotation.h"
 
 namespace NucKage {
@@ -26,6 +27,9 @@ namespace NucKage {
 		double CalculateSolidAngle();
 
 		void CheckNucleus(Nucleus& nucleus);
+		bool CheckParticle(ParticleColumns& particles, size_t index, int Z);
+
+		inline static constexpr int GetDetectorID() { return s_detectorID; }
 
 	private:
 		bool PassesAperture(double theta, double phi);
@@ -54,6 +58,7 @@ namespace NucKage {
 		//data
 		double m_bfield;
 		double m_angle;
+		NameID m_nameID;
 		TRotation m_spsRotation;
 	};
 }
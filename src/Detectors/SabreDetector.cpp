@@ -64,7 +64,7 @@ namespace NucKage {
 
 	SabreDetector::SabreDetector() :
 		m_phiCentral(0.0), m_tilt(0.0), m_translation(0.,0.,0.), m_norm_flat(0,0,1.0), m_drawingFlag(true), m_channelSmear(0.0, 1.0),
-		m_detectorID(-1)
+		m_detectorID(-1), m_nameID(NameTable::GetInstance().Intern(NameKind::Detector, "SABRE"))
 	{
 		m_YRot.RotateY(-1.0*m_tilt);
 		m_ZRot.RotateZ(m_phiCentral);
@@ -93,7 +93,8 @@ namespace NucKage {
 	
 	SabreDetector::SabreDetector(const Parameters& params) :
 		m_phiCentral(params.phiCenter), m_tilt(params.tilt), m_translation(0., 0., params.zOffset), m_norm_flat(0,0,1.0), 
-		m_drawingFlag(params.drawing), m_channelSmear(0.0, 1.0), m_detectorID(params.detID)
+		m_drawingFlag(params.drawing), m_channelSmear(0.0, 1.0), m_detectorID(params.detID),
+		m_nameID(NameTable::GetInstance().Intern(NameKind::Detector, "SABRE"))
 	{
 		m_YRot.RotateY(-1.0*m_tilt); //clockwise rotation
 		m_ZRot.RotateZ(m_phiCentral);
@@ -202,19 +203,36 @@ namespace NucKage {
 		{
 			//std::cout<<"Here: first: "<<result.first<<" second: "<<result.second<<std::endl;
 			nucleus.detected = false;
-			nucleus.detectorName = "";
+			nucleus.detectorName = NameTable::s_noName;
 		}
 		else
 		{
 			
 			nucleus.detected = true;
-			nucleus.detectorName = "SABRE";
+			nucleus.detectorName = m_nameID;
 			nucleus.detectorID = m_detectorID;
 			nucleus.detectorFrontChannel = result.first;
 			nucleus.detectorBackChannel = result.second;
 		}
 	}
 	
+	//Column version of CheckNucleus, returns whether the particle was detected
+	bool SabreDetector::CheckParticle(ParticleColumns& particles, size_t index)
+	{
+		auto result = GetTrajectoryRingWedge(particles.Theta(index), particles.Phi(index));
+		if(result.first == -1 || result.second == -1)
+		{
+			particles.detected[index] = 0;
+			return false;
+		}
+
+		particles.detected[index] = 1;
+		particles.detectorID[index] = m_detectorID;
+		particles.detectorFrontChannel[index] = result.first;
+		particles.detectorBackChannel[index] = result.second;
+		return true;
+	}
+	
 	/*
 		Given a unit vector (R=1, theta, phi) which corresponds to some particle's trajectory,
 		determine whether that particle will intersect with this SABRE detector. If it does calculate
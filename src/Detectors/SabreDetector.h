@@ -60,6 +60,7 @@
 
 #include "RandomGenerator.h"
 #include "Nucleus.h"
+#include "EventBlock.h"
 
 namespace NucKage {
 
@@ -84,6 +85,7 @@ namespace NucKage {
 		~SabreDetector();
 
 		void CheckNucleus(Nucleus& nucleus);
+		bool CheckParticle(ParticleColumns& particles, size_t index);
 	
 		/*Return coordinates of the corners of each ring/wedge in SABRE*/
 		inline TVector3 GetRingFlatCoords(int ch, int corner) { return m_drawingFlag && CheckRingLocation(ch, corner) ? m_ringCoords_flat[ch][corner] : TVector3(); }
@@ -194,6 +196,7 @@ namespace NucKage {
 		TVector3 m_norm_flat;
 		bool m_drawingFlag;
 		int m_detectorID;
+		NameID m_nameID;
 
 		std::uniform_real_distribution<double> m_channelSmear;
 	
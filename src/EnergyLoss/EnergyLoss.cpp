@@ -1,92 +1,348 @@
 #include "EnergyLoss.h"
 #include "EnergyLossConstants.h"
+#include "StoppingTable.h"
 #include <cstdlib>
 #include <cmath>
+#include <atomic>
+#include <algorithm>
 
 namespace NucKage {
 
 	namespace EnergyLoss {
 
-		double GetEnergyLoss(const Parameters& params)
+		static Integrator s_integrator = Integrator::Euler;
+		static double s_tolerance = 1.0e-6;
+		static std::atomic<uint64_t> s_nCalls = 0;
+		static std::atomic<uint64_t> s_nSteps = 0;
+		static std::atomic<uint64_t> s_nRejectedSteps = 0;
+		static std::atomic<uint64_t> s_nEvaluations = 0;
+		static std::atomic<uint64_t> s_nThinTarget = 0;
+		static std::atomic<uint64_t> s_nTableLookups = 0;
+		static thread_local IntegrationStats t_stats;
+
+		//Set once before a run (role file), read by every worker. The tolerance is kept above minTolerance.
+		void SetIntegrator(Integrator method, double tolerance)
 		{
-	
-			if(params.thickness == 0.0 || params.energy == 0.0 || params.ZP == 0)
-				return 0.0;
+			s_integrator = method;
+			s_tolerance = std::max(tolerance, minTolerance);
+		}
+
+		Integrator GetIntegrator() { return s_integrator; }
+
+		double GetIntegratorTolerance() { return s_tolerance; }
+
+		const char* GetIntegratorName(Integrator method)
+		{
+			switch(method)
+			{
+				case Integrator::Euler: return "euler";
+				case Integrator::DormandPrince: return "dopri5";
+			}
+			return "None";
+		}
+
+		//Counts of the integrations run on this thread since the last flush
+		const IntegrationStats& GetThreadIntegrationStats() { return t_stats; }
+
+		//Hand the counts of this thread to the run totals and start counting again
+		void FlushThreadIntegrationStats()
+		{
+			s_nCalls.fetch_add(t_stats.calls, std::memory_order_relaxed);
+			s_nSteps.fetch_add(t_stats.steps, std::memory_order_relaxed);
+			s_nRejectedSteps.fetch_add(t_stats.rejectedSteps, std::memory_order_relaxed);
+			s_nEvaluations.fetch_add(t_stats.evaluations, std::memory_order_relaxed);
+			s_nThinTarget.fetch_add(t_stats.thinTarget, std::memory_order_relaxed);
+			s_nTableLookups.fetch_add(t_stats.tableLookups, std::memory_order_relaxed);
+			t_stats = IntegrationStats();
+		}
+
+		IntegrationStats GetTotalIntegrationStats()
+		{
+			IntegrationStats stats;
+			stats.calls = s_nCalls;
+			stats.steps = s_nSteps;
+			stats.rejectedSteps = s_nRejectedSteps;
+			stats.evaluations = s_nEvaluations;
+			stats.thinTarget = s_nThinTarget;
+			stats.tableLookups = s_nTableLookups;
+			return stats;
+		}
+
+		void CountTableLookups(uint64_t n) { t_stats.tableLookups += n; }
+
+		/*
+			Embedded Dormand-Prince 5(4) in thickness for dE/dx = direction*S(E)/1000, with the FSAL stage reused between steps.
+			A step is accepted when the difference of the 5th and 4th order solutions is within tolerance*E, and the next step is
+			scaled from that estimate. Steps end on the changes of formula for the electronic stopping. Going forward the
+			projectile is stopped once it drops below 5% of its initial energy, as for the Euler march. Returns the final energy,
+			or -1 if the step size collapsed (maxRejectedSteps rejections in one call) and the caller should use the Euler march.
+		*/
+		static double DormandPrinceEnergy(const Parameters& params, double startEnergy, double thickness, double direction, IntegrationStats& stats)
+		{
+			static constexpr double a21 = 1.0/5.0;
+			static constexpr double a31 = 3.0/40.0, a32 = 9.0/40.0;
+			static constexpr double a41 = 44.0/45.0, a42 = -56.0/15.0, a43 = 32.0/9.0;
+			static constexpr double a51 = 19372.0/6561.0, a52 = -25360.0/2187.0, a53 = 64448.0/6561.0, a54 = -212.0/729.0;
+			static constexpr double a61 = 9017.0/3168.0, a62 = -355.0/33.0, a63 = 46732.0/5247.0, a64 = 49.0/176.0, a65 = -5103.0/18656.0;
+			static constexpr double b1 = 35.0/384.0, b3 = 500.0/1113.0, b4 = 125.0/192.0, b5 = -2187.0/6784.0, b6 = 11.0/84.0;
+			static constexpr double e1 = 71.0/57600.0, e3 = -71.0/16695.0, e4 = 71.0/1920.0, e5 = -17253.0/339200.0, e6 = 22.0/525.0, e7 = -1.0/40.0;
+
+			auto slope = [&params, direction, &stats](double energy)
+			{
+				stats.evaluations++;
+				return direction*GetStoppingPower(params, energy)/1000.0;
+			};
+
+			double energy = startEnergy;
+			double energyThreshold = 0.05*startEnergy;
+			const double boundaries[2] = { 10.0*params.massP/1000.0, 1000.0*params.massP/1000.0 }; //MeV
+			double xTraversed = 0.0;
+			int nrejected = 0;
+			double k1 = slope(energy);
+			//first step changes the energy by ~1%, the controller takes over from there
+			double xStep = std::min(thickness, 0.01*energy/std::fabs(k1));
+			while(xTraversed < thickness)
+			{
+				xStep = std::min(xStep, thickness - xTraversed);
+				double k2 = slope(energy + xStep*a21*k1);
+				double k3 = slope(energy + xStep*(a31*k1 + a32*k2));
+				double k4 = slope(energy + xStep*(a41*k1 + a42*k2 + a43*k3));
+				double k5 = slope(energy + xStep*(a51*k1 + a52*k2 + a53*k3 + a54*k4));
+				double k6 = slope(energy + xStep*(a61*k1 + a62*k2 + a63*k3 + a64*k4 + a65*k5));
+				double energyNext = energy + xStep*(b1*k1 + b3*k3 + b4*k4 + b5*k5 + b6*k6);
+				double k7 = slope(energyNext);
+				double error = std::fabs(xStep*(e1*k1 + e3*k3 + e4*k4 + e5*k5 + e6*k6 + e7*k7))/(s_tolerance*std::fabs(energy));
 
+				if(!(error <= 1.0)) //also catches a step which left the physical (positive) energies
+				{
+					stats.rejectedSteps++;
+					if(++nrejected > maxRejectedSteps)
+						return -1.0;
+					xStep *= std::isfinite(error) ? std::max(0.2, 0.9*std::pow(error, -0.2)) : 0.2;
+					continue;
+				}
 
-			double energyFinal = params.energy;
+				//The formulas change at 10 and 1000 keV/u and the stopping power is not smooth there, so a step may not step over
+				//a boundary: it is shortened to end on it (within tolerance) and the next step starts in the new regime
+				bool crossed = false;
+				for(auto& boundary : boundaries)
+				{
+					if((energy - boundary)*(energyNext - boundary) < 0.0 && std::fabs(energyNext - boundary) > s_tolerance*energy)
+					{
+						xStep *= (energy - boundary)/(energy - energyNext);
+						crossed = true;
+						break;
+					}
+				}
+				if(crossed)
+				{
+					stats.rejectedSteps++;
+					if(++nrejected > maxRejectedSteps)
+						return -1.0;
+					continue;
+				}
+
+				stats.steps++;
+				xTraversed += xStep;
+				energy = energyNext;
+				k1 = k7;
+				if(direction < 0.0 && energy <= energyThreshold)
+					return 0.0;
+				xStep *= error == 0.0 ? 5.0 : std::min(5.0, std::max(0.2, 0.9*std::pow(error, -0.2)));
+			}
+			return energy;
+		}
+
+		/*
+			Thin target: when the first estimate S(E)*x says the projectile changes its energy by less than maxThinFraction, the
+			change is taken from the stopping power at the midpoint of the path (two evaluations). The error of the midpoint
+			rule is of order (dE/E)^2 relative to the change itself, well below the error of the Euler march. Returns false,
+			without touching change, when the target is not thin enough.
+		*/
+		static bool ThinTargetEnergyChange(const Parameters& params, double startEnergy, double thickness, double direction, double& change,
+										   IntegrationStats& stats)
+		{
+			double firstChange = GetStoppingPower(params, startEnergy)*thickness/1000.0;
+			stats.evaluations++;
+			if(!(firstChange <= maxThinFraction*startEnergy))
+				return false;
+
+			change = GetStoppingPower(params, startEnergy + 0.5*direction*firstChange)*thickness/1000.0;
+			stats.evaluations++;
+			stats.thinTarget++;
+			return true;
+		}
+
+		static double EulerEnergyLoss(const Parameters& params, double startEnergy, double thickness, IntegrationStats& stats)
+		{
+			double energyFinal = startEnergy;
 			double xTraversed = 0;
-			double xStep = 0.25*params.thickness; //initial step in x
-			double energyStep = GetTotalStoppingPower(params, energyFinal)*xStep/1000.0; //initial step in e
-			double energyThreshold = 0.05*params.energy;
+			double xStep = 0.25*thickness; //initial step in x
+			double energyStep = GetStoppingPower(params, energyFinal)*xStep/1000.0; //initial step in e
+			double energyThreshold = 0.05*startEnergy;
+			stats.evaluations++;
 		
 			int depth=0;
 		
 			while(true)
 			{
+				stats.evaluations++;
 				//If intial guess of step size is too large, shrink until in range
 				if(energyStep/energyFinal > maxFracStep && depth < maxDepth)
 				{
 					depth++;
 					xStep *= 0.5;
-					energyStep = GetTotalStoppingPower(params, energyFinal)*xStep/1000.0;
+					energyStep = GetStoppingPower(params, energyFinal)*xStep/1000.0;
 				}
-				else if((xStep + xTraversed) >= params.thickness)
+				else if((xStep + xTraversed) >= thickness)
 				{ //last chunk
-				  	xStep = params.thickness - xTraversed; //get valid portion of last chunk
-				  	energyFinal -= GetTotalStoppingPower(params, energyFinal)*xStep/1000.0;
+					stats.steps++;
+				  	xStep = thickness - xTraversed; //get valid portion of last chunk
+				  	energyFinal -= GetStoppingPower(params, energyFinal)*xStep/1000.0;
 					if(energyFinal <= energyThreshold)
-						return params.energy;
+						return startEnergy;
 					else
 						break;
 				} 
 				else if(depth == maxDepth)
 				{
-					return params.energy;
+					return startEnergy;
 				}
 				else
 				{
+					stats.steps++;
 					xTraversed += xStep;
-					energyStep = GetTotalStoppingPower(params, energyFinal)*xStep/1000.0;
+					energyStep = GetStoppingPower(params, energyFinal)*xStep/1000.0;
 					energyFinal -= energyStep;
 					if(energyFinal <= energyThreshold)
-						return params.energy;
+						return startEnergy;
 				}
 			}
-			return params.energy - energyFinal;
+			return startEnergy - energyFinal;
 		}
-	
-		double GetReverseEnergyLoss(const Parameters& params)
+
+		static double EulerReverseEnergyLoss(const Parameters& params, double startEnergy, double thickness, IntegrationStats& stats)
 		{
-			double energyInitial = params.energy;
+			double energyInitial = startEnergy;
 			double xTraversed = 0.0;
-			double xStep = 0.25*params.thickness; //initial step in x
-			double energyStep = GetTotalStoppingPower(params, energyInitial)*xStep/1000.0; //initial step in E
+			double xStep = 0.25*thickness; //initial step in x
+			double energyStep = GetStoppingPower(params, energyInitial)*xStep/1000.0; //initial step in E
+			stats.evaluations++;
 		
 			while(true)
 			{
+				stats.evaluations++;
 				if(energyStep/energyInitial > maxFracStep)
 				{
 					xStep *= 0.5;
-					energyStep = GetTotalStoppingPower(params, energyInitial)*xStep/1000.0;
+					energyStep = GetStoppingPower(params, energyInitial)*xStep/1000.0;
 				}
-				else if (xTraversed+xStep > params.thickness)
+				else if (xTraversed+xStep > thickness)
 				{
-					xStep = params.thickness - xTraversed;
-					energyInitial += GetTotalStoppingPower(params, energyInitial)*xStep/1000.0;
+					stats.steps++;
+					xStep = thickness - xTraversed;
+					energyInitial += GetStoppingPower(params, energyInitial)*xStep/1000.0;
 					break;
 				}
 				else
 				{
+					stats.steps++;
 					xTraversed += xStep;
-					energyStep = GetTotalStoppingPower(params, energyInitial)*xStep/1000.0;
+					energyStep = GetStoppingPower(params, energyInitial)*xStep/1000.0;
 					energyInitial += energyStep;
 				}
 			}
 		
-			return energyInitial-params.energy;
+			return energyInitial-startEnergy;
 		}
+
+		bool TableEnergyLoss(const StoppingTable& table, double range, double energy, double thickness, bool reverse, double& loss)
+		{
+			//Reverse: E_in = R^-1(R(E_out) + x), as long as E_in is still inside of the table
+			if(reverse)
+			{
+				if(range + thickness >= table.GetMaxRange())
+					return false;
+				loss = table.GetEnergyAtRange(range + thickness) - energy;
+				return true;
+			}
+
+			//Forward: E_out = R^-1(R(E_in) - x), stopped if below the energy threshold
+			double energyFinal = table.GetEnergyAtRange(range - thickness);
+			loss = energyFinal <= 0.05*energy ? energy : energy - energyFinal;
+			return true;
+		}
+
+		double GetEnergyLoss(const Parameters& params, double energy, double thickness)
+		{
 	
+			if(thickness == 0.0 || energy == 0.0 || params.ZP == 0)
+				return 0.0;
+
+			double loss;
+			if(params.table && params.table->IsInTable(energy) &&
+			   TableEnergyLoss(*params.table, params.table->GetRange(energy), energy, thickness, false, loss))
+			{
+				t_stats.tableLookups++;
+				return loss;
+			}
+
+			t_stats.calls++;
+			double change;
+			if(ThinTargetEnergyChange(params, energy, thickness, -1.0, change, t_stats))
+				return change;
+			if(s_integrator == Integrator::DormandPrince)
+			{
+				double energyFinal = DormandPrinceEnergy(params, energy, thickness, -1.0, t_stats);
+				if(energyFinal >= 0.0)
+					return energy - energyFinal;
+			}
+			return EulerEnergyLoss(params, energy, thickness, t_stats);
+		}
+	
+		double GetReverseEnergyLoss(const Parameters& params, double energy, double thickness)
+		{
+			if(thickness == 0.0 || energy == 0.0)
+				return 0.0;
+
+			double loss;
+			if(params.table && params.table->IsInTable(energy) &&
+			   TableEnergyLoss(*params.table, params.table->GetRange(energy), energy, thickness, true, loss))
+			{
+				t_stats.tableLookups++;
+				return loss;
+			}
+
+			t_stats.calls++;
+			double change;
+			if(ThinTargetEnergyChange(params, energy, thickness, 1.0, change, t_stats))
+				return change;
+			if(s_integrator == Integrator::DormandPrince)
+			{
+				double energyInitial = DormandPrinceEnergy(params, energy, thickness, 1.0, t_stats);
+				if(energyInitial >= 0.0)
+					return energyInitial - energy;
+			}
+			return EulerReverseEnergyLoss(params, energy, thickness, t_stats);
+		}
+	
+		/*Fill in the projectile, along with the parts of the effective charge and nuclear stopping which depend only on it*/
+		void SetProjectile(Parameters& params, int zp, double massP)
+		{
+			params.ZP = zp;
+			params.massP = massP;
+			params.zpTwoThirds = std::pow(zp, 2.0/3.0);
+			params.chargeScreening = 1.034-0.1777*std::exp(-0.08114*zp);
+		}
+
+		/*Stopping power used by the integration: the tabulated value when the projectile has a table, otherwise the formulas*/
+		double GetStoppingPower(const Parameters& params, double current_energy)
+		{
+			if(params.table)
+				return params.table->GetStoppingPower(current_energy);
+			return GetTotalStoppingPower(params, current_energy);
+		}
+
 		/*Wrapper function for aquiring total stopping (elec + nuc)*/
 		double GetTotalStoppingPower(const Parameters& params, double current_energy)
 		{
@@ -96,68 +352,126 @@ namespace NucKage {
 			return GetElectronicStoppingPower(params, current_energy)+GetNuclearStoppingPower(params, current_energy);
 		}
 	
-		/*Charge rel to H*/
+		/*
+			Target independent part of CalculateEffectiveChargeRatio: the ratio for target element z is
+			((1 + (0.007 + 0.00005*z)*gammaTerm)*charge)^2. Only Z=2,3 projectiles have a gammaTerm, hydrogen has a charge of 1.
+		*/
+		static void GetEffectiveCharge(const Parameters& params, double ePerU, double& charge, double& gammaTerm)
+		{
+			const int zp = params.ZP;
+			gammaTerm = 0.0;
+			if(zp == 2)
+			{
+				double ln_epu = std::log(ePerU);
+				gammaTerm = std::exp(-std::pow(7.6-ln_epu,2.0));
+				double alpha = 0.7446 + 0.1429*ln_epu + 0.01562*std::pow(ln_epu, 2.0) - 0.00267*std::pow(ln_epu,3.0)
+								+ 1.338E-6*std::pow(ln_epu,8.0);
+				charge = (1.0-std::exp(-alpha))*2.0;
+			}
+			else if (zp == 3)
+			{
+				double ln_epu = std::log(ePerU);
+				gammaTerm = std::exp(-std::pow(7.6-ln_epu,2.0));
+				double alpha = 0.7138+0.002797*ePerU+1.348E-6*std::pow(ePerU, 2.0);
+				charge = (1-std::exp(-alpha))*3.0;
+			}
+			else if (zp > 3)
+			{
+				double zpTwoThirds = params.zpTwoThirds > 0.0 ? params.zpTwoThirds : std::pow(zp, 2.0/3.0);
+				double screening = params.chargeScreening > 0.0 ? params.chargeScreening : 1.034-0.1777*std::exp(-0.08114*zp);
+				double B = 0.886*std::pow(ePerU/25.0, 0.5)/zpTwoThirds;
+				double A = B + 0.0378*std::sin(M_PI/2.0*B);
+				charge = (1.0 - std::exp(-A)*screening)*zp;
+			}
+			else
+				charge = 1.0;
+		}
+
+		/*
+			Charge rel to H. Everything which does not depend on the target element (the energy regime, powers and logs of the
+			energy per nucleon, the effective charge of the projectile) is evaluated once, and each loop over the elements is a
+			plain reduction over the hydrogen coefficients with no temporary storage.
+		*/
 		double GetElectronicStoppingPower(const Parameters& params, double current_energy)
 		{
 			//Wants in units of keV
 			current_energy *= 1000.0;
 			double ePerU = current_energy/params.massP;
-			std::vector<double> values;
-			if(ePerU > maxHEperU)
-			{
+			if(ePerU > maxHEperU || !(ePerU > 0.0))
 				return 0.0;
-			}
-			else if (ePerU > 1000.0)
+
+			const size_t nelements = params.ZT.size();
+			const int* zt = params.ZT.data();
+			const double* composition = params.composition.data();
+			double charge, gammaTerm;
+			GetEffectiveCharge(params, ePerU, charge, gammaTerm);
+			auto chargeRatio = [charge, gammaTerm](int z)
 			{
-				for(auto& z: params.ZT)
-					values.push_back(Hydrogen_dEdx_High(ePerU, params.massP, current_energy, z));
-			}
-			else if (ePerU > 10.0)
+				double ratio = (1.0 + (0.007+0.00005*z)*gammaTerm)*charge;
+				return ratio*ratio;
+			};
+
+			double stopping_total = 0.0;
+			if (ePerU > 1000.0)
 			{
-				for(auto& z: params.ZT)
-					values.push_back(Hydrogen_dEdx_Med(ePerU, z));
+				double energy = current_energy/1000.0; //back to MeV for ease of beta calc
+				double beta_sq = energy * (energy+2.0*params.massP/mev2u)/std::pow(energy+params.massP/mev2u, 2.0);
+				double inv_beta_sq = 1.0/beta_sq;
+				double beta_term = beta_sq/(1.0-beta_sq);
+				double ln_epu = std::log(ePerU);
+				double ln_epu2 = ln_epu*ln_epu;
+				for(size_t i=0; i<nelements; i++)
+				{
+					const double* c = hydrogenCoefficients[zt[i]];
+					double epsilon = c[6]*beta_term - beta_sq - c[7] + ln_epu*(c[8] + ln_epu*c[9]) + ln_epu2*ln_epu*(c[10] + ln_epu*c[11]);
+					stopping_total += composition[i]*chargeRatio(zt[i])*c[5]*inv_beta_sq*std::log(epsilon);
+				}
 			}
-			else if (ePerU > 0.0)
+			else if (ePerU > 10.0)
 			{
-				for(auto& z: params.ZT)
-					values.push_back(Hydrogen_dEdx_Low(ePerU, z));
+				double epu_pow = std::pow(ePerU, 0.45);
+				double inv_epu = 1.0/ePerU;
+				for(size_t i=0; i<nelements; i++)
+				{
+					const double* c = hydrogenCoefficients[zt[i]];
+					double x = c[1]*epu_pow;
+					double y = c[2]*inv_epu*std::log(1.0+c[3]*inv_epu+c[4]*ePerU);
+					stopping_total += composition[i]*chargeRatio(zt[i])*x*y/(x+y);
+				}
 			}
 			else
 			{
-				return 0.0;
+				double epu_sqrt = std::sqrt(ePerU);
+				for(size_t i=0; i<nelements; i++)
+					stopping_total += composition[i]*chargeRatio(zt[i])*epu_sqrt*hydrogenCoefficients[zt[i]][0];
 			}
-		
-			if(values.size() == 0)
-				return 0.0; //bad
-		
-			if(params.ZP > 1)
-			{ //not hydrogen, need to account for effective charge
-				for(unsigned int i=0; i<values.size(); i++)
-					values[i] *= CalculateEffectiveChargeRatio(ePerU, params.ZP, params.ZT[i]);
-			}
-			
-			double stopping_total = 0;
-			double conversion_factor = 0;
-			for(size_t i=0; i< params.ZT.size(); i++)
-			{
+
+			return stopping_total*GetElectronicConversion(params);
+		}
+
+		/*avogadro over the composition weighted mass of the target, precomputed by Target::SetParameters*/
+		double GetElectronicConversion(const Parameters& params)
+		{
+			if(params.electronicConversion > 0.0)
+				return params.electronicConversion;
+
+			double conversion_factor = 0.0;
+			for(size_t i=0; i<params.ZT.size(); i++)
 				conversion_factor += params.composition[i]*naturalMassList[params.ZT[i]];
-				stopping_total += values[i]*params.composition[i];
-			}
-			stopping_total *= avogadro/conversion_factor;
-		
-			return stopping_total;
+			return avogadro/conversion_factor;
 		}
-	
+
 		//Returns units of keV/(ug/cm^2)
 		double GetNuclearStoppingPower(const Parameters& params, double energy)
 		{
 			energy *= 1000.0;
 			double stopping_total = 0.0;
 			double sn, x, epsilon, conversion_factor, massT;
+			double zpTwoThirds = params.zpTwoThirds > 0.0 ? params.zpTwoThirds : std::pow(params.ZP, 2.0/3.0);
 			for(size_t i=0; i<params.ZT.size(); i++)
 			{
 				massT = naturalMassList[params.ZT[i]];
-				x = (params.massP + massT) * std::sqrt(std::pow(params.ZP, 2.0/3.0) + std::pow(params.ZT[i], 2.0/3.0));
+				x = (params.massP + massT) * std::sqrt(zpTwoThirds + std::pow(params.ZT[i], 2.0/3.0));
 				epsilon = 32.53*massT*energy/(params.ZP*params.ZT[i]*x);
 				sn = 8.462*(0.5*std::log(1.0+epsilon)/(epsilon+0.10718*std::pow(epsilon, 0.37544)))*params.ZP*params.ZT[i]*params.massP/x;
 				conversion_factor = avogadro/massT;
@@ -13,28 +13,68 @@ Written by G.W. McCann Aug. 2020
 #define ENERGYLOSS_H
 
 #include <vector>
+#include <cstdint>
 
 namespace NucKage {
 
+	class StoppingTable;
+
 	namespace EnergyLoss {
 
+		//The projectile and the target material. Nothing in here changes from call to call, the energy and the thickness are
+		//passed to the integration functions, so one set of parameters can be used by any number of threads at once.
 		struct Parameters
 		{
-			int ZP;
-			double massP;
+			int ZP=0;
+			double massP=0.0;
 			std::vector<int> ZT;
 			std::vector<double> composition; //percent composition
-			double energy;
-			double thickness;
+			double electronicConversion = 0.0; //avogadro/(composition weighted mass), 0 if not precomputed
+			double zpTwoThirds = 0.0; //ZP^(2/3), 0 if not precomputed
+			double chargeScreening = 0.0; //1.034 - 0.1777*exp(-0.08114*ZP) of the heavy ion effective charge, 0 if not precomputed
+			const StoppingTable* table = nullptr; //tabulated stopping power for this projectile, if there is one
 		};
 	
-		//Main integration functions
-		double GetEnergyLoss(const Parameters& params);
-		double GetReverseEnergyLoss(const Parameters& params);
+		//Method used when the energy loss has to be integrated (no range table for the projectile, or outside of it) and the
+		//target is not thin enough for the midpoint formula
+		enum class Integrator
+		{
+			Euler, //fixed fractional energy step of maxFracStep
+			DormandPrince //adaptive 5(4) Runge-Kutta with a relative energy tolerance per step
+		};
+
+		struct IntegrationStats
+		{
+			uint64_t calls=0; //energy losses not answered by a range table
+			uint64_t steps=0; //accepted steps
+			uint64_t rejectedSteps=0;
+			uint64_t evaluations=0; //stopping power evaluations
+			uint64_t thinTarget=0; //calls answered by the thin target formula instead of the integrator
+			uint64_t tableLookups=0; //energy losses answered by a range table
+		};
+
+		void SetIntegrator(Integrator method, double tolerance);
+		Integrator GetIntegrator();
+		double GetIntegratorTolerance();
+		const char* GetIntegratorName(Integrator method);
+		const IntegrationStats& GetThreadIntegrationStats();
+		void FlushThreadIntegrationStats();
+		IntegrationStats GetTotalIntegrationStats();
+		void CountTableLookups(uint64_t n); //for callers which invert the range tables themselves (batches)
+
+		//Main integration functions, energy in MeV and thickness in ug/cm^2
+		double GetEnergyLoss(const Parameters& params, double energy, double thickness);
+		double GetReverseEnergyLoss(const Parameters& params, double energy, double thickness);
+		//Range table inversion shared by the single particle and batch paths, range is table.GetRange(energy).
+		//False when the table can not answer (reverse past the end of the table), then integrate instead.
+		bool TableEnergyLoss(const StoppingTable& table, double range, double energy, double thickness, bool reverse, double& loss);
 		
 		//Helpers
+		void SetProjectile(Parameters& params, int zp, double massP);
+		double GetStoppingPower(const Parameters& params, double current_energy);
 		double GetTotalStoppingPower(const Parameters& params, double current_energy);
 		double GetElectronicStoppingPower(const Parameters& params, double current_energy);
+		double GetElectronicConversion(const Parameters& params);
 		double GetNuclearStoppingPower(const Parameters& params, double current_energy);
 		double Hydrogen_dEdx_Low(double ePerU, int z);
 		double Hydrogen_dEdx_Med(double ePerU, int z);
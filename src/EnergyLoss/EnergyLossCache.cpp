@@ -0,0 +1,33 @@
+/*
+
+EnergyLossCache.cpp
+Optional per-thread memoization of integrated energy losses. See EnergyLossCache.h.
+
+*/
+#include "EnergyLossCache.h"
+
+namespace NucKage {
+
+	double EnergyLossCache::s_quantization = 0.0;
+	std::atomic<uint64_t> EnergyLossCache::s_nHits = 0;
+	std::atomic<uint64_t> EnergyLossCache::s_nMisses = 0;
+	thread_local std::unordered_map<EnergyLossCache::Key, double, EnergyLossCache::KeyHash> EnergyLossCache::t_nodes;
+	thread_local EnergyLossCache::Stats EnergyLossCache::t_stats;
+
+	//Hand the counts of this thread to the run totals and start counting again
+	void EnergyLossCache::FlushThreadStats()
+	{
+		s_nHits.fetch_add(t_stats.hits, std::memory_order_relaxed);
+		s_nMisses.fetch_add(t_stats.misses, std::memory_order_relaxed);
+		t_stats = Stats();
+	}
+
+	EnergyLossCache::Stats EnergyLossCache::GetTotalStats()
+	{
+		Stats stats;
+		stats.hits = s_nHits;
+		stats.misses = s_nMisses;
+		return stats;
+	}
+
+}
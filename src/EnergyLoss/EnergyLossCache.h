@@ -0,0 +1,103 @@
+/*
+
+EnergyLossCache.h
+Optional per-thread memoization of integrated energy losses. Energy losses are stored on a grid of nodes, quantized in
+log(E) with a spacing of the quantization q (relative energy) and in path length with a spacing of q times the thickness
+of the target layer, and a requested loss is interpolated bilinearly between the four surrounding nodes. The interpolation error
+is of order q^2 of the loss. Nodes are computed on the first request, so only the (narrow) part of the grid which a
+chain actually visits is ever filled: a beam of ~1 keV spread sits in one or two energy cells.
+
+The cache is for species and energies which are not covered by a range table (see StoppingTable.h), where every energy
+loss would otherwise be a full integration. Registered species have tables over the whole energy range, so in a run the
+cache only serves them when range tables are turned off (role file option energyloss_tables off). Each thread has its own cache, so there is no locking; the hit and miss
+counts are kept per thread and flushed into the run totals like the integration counts. The cache is off unless a
+quantization is set (role file option energyloss_cache).
+
+*/
+#ifndef ENERGY_LOSS_CACHE_H
+#define ENERGY_LOSS_CACHE_H
+
+#include <unordered_map>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+namespace NucKage {
+
+	class EnergyLossCache
+	{
+	public:
+		struct Key
+		{
+			uint32_t target; //target layer, copies of a target share the IDs of its layers
+			int Z;
+			int A;
+			int64_t energyNode;
+			int64_t thicknessNode;
+
+			inline bool operator==(const Key& other) const
+			{
+				return target == other.target && Z == other.Z && A == other.A && energyNode == other.energyNode &&
+					   thicknessNode == other.thicknessNode;
+			}
+		};
+
+		struct Stats
+		{
+			uint64_t hits=0;
+			uint64_t misses=0;
+		};
+
+		//Loss stored for key, computed by compute() on a miss
+		template<typename Func>
+		static double FindNode(const Key& key, Func&& compute)
+		{
+			auto iter = t_nodes.find(key);
+			if(iter != t_nodes.end())
+			{
+				t_stats.hits++;
+				return iter->second;
+			}
+
+			t_stats.misses++;
+			if(t_nodes.size() >= s_maxNodes)
+				t_nodes.clear();
+			double loss = compute();
+			t_nodes.emplace(key, loss);
+			return loss;
+		}
+
+		//q <= 0 turns the cache off. Set before a run, and it clears nothing: nodes of another quantization are never asked for
+		inline static void SetQuantization(double q) { s_quantization = q; }
+		inline static double GetQuantization() { return s_quantization; }
+		inline static bool IsEnabled() { return s_quantization > 0.0; }
+
+		inline static const Stats& GetThreadStats() { return t_stats; }
+		static void FlushThreadStats();
+		static Stats GetTotalStats();
+
+		static constexpr size_t s_maxNodes = 1 << 20; //per thread, the cache starts over when full
+
+	private:
+		struct KeyHash
+		{
+			inline size_t operator()(const Key& key) const
+			{
+				uint64_t h = key.target;
+				h = h*0x9E3779B97F4A7C15ULL ^ (uint64_t(key.Z) << 16 | uint64_t(key.A));
+				h = h*0x9E3779B97F4A7C15ULL ^ uint64_t(key.energyNode);
+				h = h*0x9E3779B97F4A7C15ULL ^ uint64_t(key.thicknessNode);
+				return h ^ (h >> 29);
+			}
+		};
+
+		static double s_quantization;
+		static std::atomic<uint64_t> s_nHits;
+		static std::atomic<uint64_t> s_nMisses;
+		static thread_local std::unordered_map<Key, double, KeyHash> t_nodes;
+		static thread_local Stats t_stats;
+	};
+
+}
+
+#endif
@@ -7,6 +7,9 @@ namespace NucKage {
 
 		static constexpr double maxFracStep = 0.001;
 		static constexpr int maxDepth = 50;
+		static constexpr double maxThinFraction = 0.01; //largest estimated dE/E handled by the thin target midpoint formula
+		static constexpr double minTolerance = 1.0e-12; //smallest relative tolerance of the Dormand-Prince integrator
+		static constexpr int maxRejectedSteps = 1000; //rejected Dormand-Prince steps in one call before falling back to Euler
 		static constexpr double maxHEperU = 100000.0;
 		static constexpr double avogadro = 0.60221367; //N_A times 10^(-24) for converting
 		static constexpr double mev2u = 1.0/931.4940954;
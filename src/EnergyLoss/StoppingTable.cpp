@@ -0,0 +1,148 @@
+/*
+
+StoppingTable.cpp
+Tabulated total stopping power of one projectile species in one target compound. See StoppingTable.h for the layout and
+accuracy of the table.
+
+*/
+#include "StoppingTable.h"
+#include "EnergyLossConstants.h"
+
+namespace NucKage {
+
+	StoppingTableRegistry* StoppingTableRegistry::s_instance = new StoppingTableRegistry();
+
+	static inline double StoppingPolynomial(const double* c, double t)
+	{
+		return c[0] + t*(c[1] + t*(c[2] + t*c[3]));
+	}
+
+	StoppingTable::StoppingTable(const EnergyLoss::Parameters& params) :
+		m_params(params)
+	{
+		m_params.table = nullptr;
+
+		//Offsets (in fractions of an interval) used to stay inside of an interval when taking values and slopes
+		static constexpr double edgeOffset = 1.0e-7;
+		static constexpr double slopeStep = 1.0e-4;
+
+		const int minDecade = static_cast<int>(std::lround(std::log10(s_minEnergyPerU)));
+		const int nDecades = static_cast<int>(std::lround(std::log10(EnergyLoss::maxHEperU))) - minDecade;
+		const int nIntervals = nDecades*s_nodesPerDecade;
+		const double energyPerU = params.massP/1000.0; //MeV per keV/u
+
+		std::vector<double> logNodes(nIntervals + 1);
+		for(int i=0; i<=nIntervals; i++)
+		{
+			int decade = minDecade + i/s_nodesPerDecade;
+			double fraction = double(i % s_nodesPerDecade)/s_nodesPerDecade;
+			logNodes[i] = std::log(std::pow(10.0, decade)*std::pow(10.0, fraction)*energyPerU);
+		}
+
+		m_coefficients.resize(nIntervals);
+		for(int i=0; i<nIntervals; i++)
+		{
+			double logLow = logNodes[i];
+			double logWidth = logNodes[i+1] - logNodes[i];
+			auto stopping = [this, logLow, logWidth](double t)
+			{
+				return EnergyLoss::GetTotalStoppingPower(m_params, std::exp(logLow + t*logWidth));
+			};
+
+			double y0 = stopping(edgeOffset);
+			double y1 = stopping(1.0 - edgeOffset);
+			//second order one-sided differences, so a change of formula at the interval edge is never straddled
+			double m0 = (-3.0*y0 + 4.0*stopping(edgeOffset + slopeStep) - stopping(edgeOffset + 2.0*slopeStep))/(2.0*slopeStep);
+			double m1 = (3.0*y1 - 4.0*stopping(1.0 - edgeOffset - slopeStep) + stopping(1.0 - edgeOffset - 2.0*slopeStep))/(2.0*slopeStep);
+
+			double* c = m_coefficients[i].c;
+			c[0] = y0;
+			c[1] = m0;
+			c[2] = 3.0*(y1 - y0) - 2.0*m0 - m1;
+			c[3] = 2.0*(y0 - y1) + m0 + m1;
+		}
+
+		//Range: dR = 1000*dE/S = 1000*E*logWidth/S dt (S in keV/(ug/cm^2), E in MeV)
+		static constexpr double gaussNodes[5] = { -0.9061798459386640, -0.5384693101056831, 0.0, 0.5384693101056831, 0.9061798459386640 };
+		static constexpr double gaussWeights[5] = { 0.2369268850561891, 0.4786286704993665, 0.5688888888888889, 0.4786286704993665, 0.2369268850561891 };
+		m_ranges.resize(nIntervals + 1);
+		double minEnergy = std::exp(logNodes.front());
+		m_ranges[0] = 2000.0*minEnergy/StoppingPolynomial(m_coefficients[0].c, 0.0); //S ~ sqrt(E) below the table
+		for(int i=0; i<nIntervals; i++)
+		{
+			double logLow = logNodes[i];
+			double logWidth = logNodes[i+1] - logNodes[i];
+			const double* c = m_coefficients[i].c;
+			auto rangeSlope = [c, logLow, logWidth](double t)
+			{
+				return 1000.0*std::exp(logLow + t*logWidth)*logWidth/StoppingPolynomial(c, t);
+			};
+
+			double width = 0.0;
+			for(int j=0; j<5; j++)
+				width += 0.5*gaussWeights[j]*rangeSlope(0.5*(gaussNodes[j] + 1.0));
+			m_ranges[i+1] = m_ranges[i] + width;
+
+			double m0 = rangeSlope(0.0);
+			double m1 = rangeSlope(1.0);
+			double* r = m_coefficients[i].r;
+			r[0] = m_ranges[i];
+			r[1] = m0;
+			r[2] = 3.0*width - 2.0*m0 - m1;
+			r[3] = -2.0*width + m0 + m1;
+		}
+
+		m_minEnergy = std::exp(logNodes.front());
+		m_maxEnergy = std::exp(logNodes.back());
+		m_logMinEnergy = logNodes.front();
+		m_inverseStep = s_nodesPerDecade/std::log(10.0);
+		m_nIntervals = nIntervals;
+	}
+
+	StoppingTable::~StoppingTable() {}
+
+	/*
+		Energy (MeV) at which the projectile has the given range (ug/cm^2). Ranges below the first node are below the table,
+		and the projectile is taken as stopped. Ranges above the last node must be handled by the caller.
+	*/
+	double StoppingTable::GetEnergyAtRange(double range) const
+	{
+		if(range <= m_ranges.front())
+			return 0.0;
+
+		size_t index = std::upper_bound(m_ranges.begin(), m_ranges.end(), range) - m_ranges.begin() - 1;
+		index = std::min(index, m_coefficients.size() - 1);
+		const double* r = m_coefficients[index].r;
+
+		//R(t) is monotonic in the interval: Newton from the linear guess
+		double t = (range - m_ranges[index])/(m_ranges[index+1] - m_ranges[index]);
+		for(int i=0; i<4; i++)
+		{
+			double value = r[0] + t*(r[1] + t*(r[2] + t*r[3])) - range;
+			double slope = r[1] + t*(2.0*r[2] + t*3.0*r[3]);
+			t -= value/slope;
+		}
+		t = std::min(std::max(t, 0.0), 1.0);
+
+		return std::exp(m_logMinEnergy + (index + t)/m_inverseStep);
+	}
+
+	StoppingTableRegistry::StoppingTableRegistry() {}
+
+	StoppingTableRegistry::~StoppingTableRegistry() {}
+
+	std::shared_ptr<const StoppingTable> StoppingTableRegistry::FindTable(const EnergyLoss::Parameters& params)
+	{
+		Key key = { params.ZP, params.massP, params.ZT, params.composition };
+
+		std::lock_guard<std::mutex> guard(m_tableMutex);
+		auto iter = m_tables.find(key);
+		if(iter != m_tables.end())
+			return iter->second;
+
+		auto table = std::make_shared<const StoppingTable>(params);
+		m_tables[key] = table;
+		return table;
+	}
+
+}
@@ -0,0 +1,133 @@
+/*
+
+StoppingTable.h
+Tabulated total stopping power (electronic + nuclear) of one projectile species in one target compound. The table is
+built once from the analytic formulas in EnergyLoss and then used in place of them by the energy loss integration.
+
+Nodes are log-spaced in energy per nucleon, s_nodesPerDecade per decade from s_minEnergyPerU to maxHEperU (keV/u). The
+decades start on powers of ten, so the changes of formula at 10 keV/u and 1000 keV/u fall on nodes, and each interval is
+a cubic Hermite polynomial in log(E) built from the values and slopes taken inside that interval. With 32 nodes per decade
+the interpolated stopping power agrees with the analytic formulas to better than 1e-5 (relative) over the whole table
+range for the light ions and targets we use (see StoppingTableTest in Tests/tests.h). Energies outside of the table range
+fall back to the analytic formulas.
+
+The table also holds the (CSDA) range R(E) in ug/cm^2, the thickness needed to stop a projectile of energy E. Node
+ranges are integrals of 1/S over the tabulated stopping power (Gauss-Legendre per interval, with the range below the
+first node taken from S ~ sqrt(E)), and inside an interval R is the cubic Hermite polynomial in the interval fraction
+from the node ranges and dR/dt. Energy loss through a thickness x is then E_out = R^-1(R(E_in) - x) and reverse energy
+loss E_in = R^-1(R(E_out) + x): a binary search over the node ranges and a few Newton steps on the same cubic, so that
+the inversion is exact with respect to the forward range (a zero thickness gives back the same energy).
+
+Tables are shared: StoppingTableRegistry hands out one table per (projectile, target compound) pair, so every chain using
+the same target and species (and every chunk copy of a chain) uses the same table.
+
+*/
+#ifndef STOPPING_TABLE_H
+#define STOPPING_TABLE_H
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include "EnergyLoss.h"
+
+namespace NucKage {
+
+	class StoppingTable
+	{
+	public:
+		StoppingTable(const EnergyLoss::Parameters& params);
+		~StoppingTable();
+
+		//Total stopping power in keV/(ug/cm^2) for a projectile of kinetic energy energy (MeV)
+		inline double GetStoppingPower(double energy) const
+		{
+			double x = (std::log(energy) - m_logMinEnergy)*m_inverseStep;
+			if(!(x >= 0.0 && x < m_nIntervals))
+				return EnergyLoss::GetTotalStoppingPower(m_params, energy);
+			size_t index = static_cast<size_t>(x);
+			double t = x - index;
+			const double* c = m_coefficients[index].c;
+			return c[0] + t*(c[1] + t*(c[2] + t*c[3]));
+		}
+
+		//Range in ug/cm^2 of a projectile of kinetic energy energy (MeV), which must be inside of the table range
+		inline double GetRange(double energy) const
+		{
+			double x = (std::log(energy) - m_logMinEnergy)*m_inverseStep;
+			size_t index = std::min(static_cast<size_t>(x), m_coefficients.size() - 1);
+			double t = x - index;
+			const double* r = m_coefficients[index].r;
+			return r[0] + t*(r[1] + t*(r[2] + t*r[3]));
+		}
+
+		double GetEnergyAtRange(double range) const;
+
+		inline bool IsInTable(double energy) const { return energy >= m_minEnergy && energy < m_maxEnergy; }
+		inline double GetMinRange() const { return m_ranges.front(); }
+		inline double GetMaxRange() const { return m_ranges.back(); }
+		inline double GetMinEnergy() const { return m_minEnergy; }
+		inline double GetMaxEnergy() const { return m_maxEnergy; }
+		inline size_t GetNumberOfNodes() const { return m_coefficients.size() + 1; }
+
+		static constexpr int s_nodesPerDecade = 32;
+		static constexpr double s_minEnergyPerU = 0.1; //keV/u
+
+	private:
+		struct Interval
+		{
+			double c[4]; //cubic in the fraction of the interval
+			double r[4]; //range cubic in the fraction of the interval
+		};
+
+		EnergyLoss::Parameters m_params; //composition and projectile, for the fallback outside of the table
+		double m_minEnergy, m_maxEnergy; //MeV
+		double m_logMinEnergy;
+		double m_inverseStep;
+		double m_nIntervals;
+		std::vector<Interval> m_coefficients;
+		std::vector<double> m_ranges; //range at each node, for the inversion
+	};
+
+	class StoppingTableRegistry
+	{
+	public:
+		StoppingTableRegistry();
+		~StoppingTableRegistry();
+
+		//Table for the projectile and target compound in params (ZP, massP, ZT, composition), built on first request
+		std::shared_ptr<const StoppingTable> FindTable(const EnergyLoss::Parameters& params);
+		inline size_t GetNumberOfTables() const { return m_tables.size(); }
+
+		inline static StoppingTableRegistry& GetInstance() { return *s_instance; }
+
+	private:
+		struct Key
+		{
+			int ZP;
+			double massP;
+			std::vector<int> ZT;
+			std::vector<double> composition;
+
+			inline bool operator<(const Key& other) const
+			{
+				if(ZP != other.ZP)
+					return ZP < other.ZP;
+				else if(massP != other.massP)
+					return massP < other.massP;
+				else if(ZT != other.ZT)
+					return ZT < other.ZT;
+				return composition < other.composition;
+			}
+		};
+
+		static StoppingTableRegistry* s_instance;
+		std::map<Key, std::shared_ptr<const StoppingTable>> m_tables;
+		std::mutex m_tableMutex;
+	};
+
+}
+
+#endif
@@ -2,7 +2,7 @@
 
 Target.cpp
 A basic target unit for use in the SPANCRedux environment. A target
-is defined as a single compound with elements Z,A of a given stoichiometry 
+is defined as a single compound with elements Z,A of a given stoichiometry
 Holds an energy loss class
 
 Based on code by D.W. Visser written at Yale for the original SPANC
@@ -14,104 +14,451 @@ Written by G.W. McCann Aug. 2020
 #include "EnergyLossConstants.h"
 #include "MassLookup.h"
 #include <cmath>
+#include <algorithm>
 
 namespace NucKage {
 
+	std::atomic<uint32_t> Target::s_nextCacheID = 0;
+	bool Target::s_useRangeTables = true;
+	const EnergyLoss::Parameters Target::s_noParameters;
+
 	Target::Target() :
-		m_totalThickness(0.0), m_isValid(false)
+		m_reactionLayer(0), m_totalThickness(0.0), m_isValid(false)
 	{
 	}
 
 	/*Targets must be of known thickness*/
 	Target::Target(const std::vector<int>& z, const std::vector<int>& stoich, double thick) :
-		m_isValid(false)
+		m_reactionLayer(0), m_totalThickness(0.0), m_isValid(false)
 	{
 		SetParameters(z, stoich, thick);
 	}
-	
+
 	Target::~Target()
 	{
 	}
-	
+
 	/*Set target elements of given Z, A, S*/
 	void Target::SetParameters(const std::vector<int>& z, const std::vector<int>& stoich, double thick)
 	{
-		m_params.ZT = z;
+		m_layers.clear();
+		m_reactionLayer = 0;
+		m_totalThickness = 0.0;
+		AddLayer(z, stoich, thick);
+	}
+
+	/*Add a layer of elements of given Z, A, S behind (downstream of) the others. Species have to be registered again.*/
+	void Target::AddLayer(const std::vector<int>& z, const std::vector<int>& stoich, double thick)
+	{
+		Layer layer;
+		layer.params.ZT = z;
 		double denom = 0;
 		for(auto& s : stoich)
 			denom += s;
 		for(auto& s : stoich)
-			m_params.composition.push_back(s/denom);
-		m_totalThickness = thick;
+			layer.params.composition.push_back(s/denom);
+		layer.params.electronicConversion = EnergyLoss::GetElectronicConversion(layer.params);
+		layer.depth = m_totalThickness;
+		layer.thickness = thick;
+		layer.cacheID = ++s_nextCacheID;
+		m_layers.push_back(layer);
+		m_totalThickness += thick;
+
+		m_projectiles.clear();
+		m_noProjectile = Projectile();
+		for(auto& material : m_layers)
+		{
+			LayerProjectile none;
+			none.params = material.params;
+			m_noProjectile.layers.push_back(none);
+		}
 		m_isValid = true;
 	}
-	
-	/*Calculates energy loss for travelling all the way through the target*/
-	double Target::GetEnergyLossTotal(int zp, int ap, double startEnergy, double theta)
+
+	void Target::SetReactionLayer(size_t layer)
+	{
+		if(layer < m_layers.size())
+			m_reactionLayer = layer;
+	}
+
+	/*First layer (upstream to downstream) which contains the element z, -1 if there is none*/
+	int Target::FindLayer(int z) const
 	{
-		m_params.ZP = zp;
-		m_params.massP = MassLookup::GetInstance().FindMass(zp, ap)*EnergyLoss::mev2u;
+		for(size_t i=0; i<m_layers.size(); i++)
+		{
+			if(std::find(m_layers[i].params.ZT.begin(), m_layers[i].params.ZT.end(), z) != m_layers[i].params.ZT.end())
+				return static_cast<int>(i);
+		}
+		return -1;
+	}
 
-		if(theta == M_PI/2.) 
-			return startEnergy;
-		else if (theta > M_PI/2.) 
-			theta = M_PI - theta;
+	/*
+		Tabulate the stopping power of a projectile species in every layer of this target. Called when the target is bound
+		to the reactors which will send the species through it, which keep the handle for their energy loss calls. Species
+		which were never registered can still be sent through by (Z, A), with the analytic stopping power. With range tables
+		turned off the species is registered without tables. A species registered again after the setting changed keeps its
+		handle and has its tables built or dropped, so the setting holds no matter when the target was first bound.
+	*/
+	Target::ProjectileHandle Target::RegisterProjectile(int zp, int ap)
+	{
+		ProjectileHandle handle;
+		if(!m_isValid || zp == 0)
+			return handle;
 
-		m_params.energy = startEnergy;
-		m_params.thickness = m_totalThickness/(std::fabs(std::cos(theta)));
+		handle.m_index = FindProjectile(zp, ap);
+		if(handle.IsValid())
+		{
+			Projectile& projectile = m_projectiles[handle.m_index];
+			if(projectile.tabulated != s_useRangeTables)
+				SetTables(projectile);
+			return handle;
+		}
 
-		return EnergyLoss::GetEnergyLoss(m_params);
+		Projectile projectile;
+		SetProjectile(projectile, zp, ap);
+		SetTables(projectile);
+		m_projectiles.push_back(projectile);
+		handle.m_index = static_cast<int>(m_projectiles.size()) - 1;
+		return handle;
 	}
 
-	/*Calculates the energy loss for traveling some fraction through the target*/
-	double Target::GetEnergyLossFractionalDepth(int zp, int ap, double startEnergy, double theta, double percent_depth)
+	void Target::SetTables(Projectile& projectile) const
 	{
-		m_params.ZP = zp;
-		m_params.massP = MassLookup::GetInstance().FindMass(zp, ap)*EnergyLoss::mev2u;
+		for(auto& layer : projectile.layers)
+		{
+			layer.table = s_useRangeTables ? StoppingTableRegistry::GetInstance().FindTable(layer.params) : nullptr;
+			layer.params.table = layer.table.get();
+		}
+		projectile.tabulated = s_useRangeTables;
+	}
 
-		if(theta == M_PI/2.)
-			return startEnergy;
-		else if (theta > M_PI/2.)
-			theta = M_PI-theta;
+	size_t Target::GetNumberOfTables() const
+	{
+		size_t ntables = 0;
+		for(auto& projectile : m_projectiles)
+		{
+			if(projectile.tabulated)
+				ntables += projectile.layers.size();
+		}
+		return ntables;
+	}
+
+	int Target::FindProjectile(int zp, int ap) const
+	{
+		for(size_t i=0; i<m_projectiles.size(); i++)
+		{
+			if(m_projectiles[i].Z == zp && m_projectiles[i].A == ap)
+				return static_cast<int>(i);
+		}
+		return -1;
+	}
 
-		m_params.energy = startEnergy;
-		m_params.thickness = m_totalThickness*percent_depth/(std::fabs(std::cos(theta)));
+	void Target::SetProjectile(Projectile& projectile, int zp, int ap) const
+	{
+		projectile.Z = zp;
+		projectile.A = ap;
+		projectile.layers.resize(m_layers.size());
+		double massP = MassLookup::GetInstance().FindMass(zp, ap)*EnergyLoss::mev2u;
+		for(size_t i=0; i<m_layers.size(); i++)
+		{
+			projectile.layers[i].params = m_layers[i].params;
+			EnergyLoss::SetProjectile(projectile.layers[i].params, zp, massP);
+			projectile.layers[i].params.table = nullptr;
+			projectile.layers[i].table = nullptr;
+		}
+	}
+
+	/*The registered species, or, for a species which was never registered, the caller's scratch copy filled in with it*/
+	const Target::Projectile& Target::GetProjectile(int zp, int ap, Projectile& scratch) const
+	{
+		int index = FindProjectile(zp, ap);
+		if(index >= 0)
+			return m_projectiles[index];
 
-		return EnergyLoss::GetEnergyLoss(m_params);
+		SetProjectile(scratch, zp, ap);
+		return scratch;
 	}
-	
-	/*Calculates reverse energy loss for travelling all the way through the target*/
-	double Target::GetReverseEnergyLossTotal(int zp, int ap, double finalEnergy, double theta)
+
+	/*Depths (ug/cm^2 from the upstream face) where a path starts and ends*/
+	void Target::GetPathDepths(Path path, double fraction, double theta, double& start, double& end) const
+	{
+		double reactionDepth = 0.0;
+		if(path != Path::Stack && m_reactionLayer < m_layers.size())
+			reactionDepth = m_layers[m_reactionLayer].depth + fraction*m_layers[m_reactionLayer].thickness;
+
+		switch(path)
+		{
+			case Path::Stack:
+				start = 0.0;
+				end = fraction*m_totalThickness;
+				return;
+			case Path::Beam:
+				start = 0.0;
+				end = reactionDepth;
+				return;
+			case Path::Ejectile:
+				start = reactionDepth;
+				end = theta < M_PI/2. ? m_totalThickness : 0.0;
+				return;
+		}
+	}
+
+	double Target::GetEnergyLossTotal(ProjectileHandle projectile, double startEnergy, double theta) const
+	{
+		return GetEnergyLoss(GetProjectile(projectile), false, Path::Stack, startEnergy, theta, 1.0);
+	}
+
+	double Target::GetEnergyLossFractionalDepth(ProjectileHandle projectile, double startEnergy, double theta, double percent_depth) const
+	{
+		return GetEnergyLoss(GetProjectile(projectile), false, Path::Stack, startEnergy, theta, percent_depth);
+	}
+
+	double Target::GetReverseEnergyLossTotal(ProjectileHandle projectile, double finalEnergy, double theta) const
+	{
+		return GetEnergyLoss(GetProjectile(projectile), true, Path::Stack, finalEnergy, theta, 1.0);
+	}
+
+	double Target::GetReverseEnergyLossFractionalDepth(ProjectileHandle projectile, double finalEnergy, double theta, double percent_depth) const
+	{
+		return GetEnergyLoss(GetProjectile(projectile), true, Path::Stack, finalEnergy, theta, percent_depth);
+	}
+
+	void Target::GetEnergyLossBatch(ProjectileHandle projectile, const double* startEnergy, const double* theta, const double* percent_depth, double* loss, size_t n) const
+	{
+		GetEnergyLossBatch(GetProjectile(projectile), false, Path::Stack, startEnergy, theta, percent_depth, loss, n);
+	}
+
+	void Target::GetReverseEnergyLossBatch(ProjectileHandle projectile, const double* finalEnergy, const double* theta, const double* percent_depth, double* loss, size_t n) const
+	{
+		GetEnergyLossBatch(GetProjectile(projectile), true, Path::Stack, finalEnergy, theta, percent_depth, loss, n);
+	}
+
+	double Target::GetBeamEnergyLoss(ProjectileHandle projectile, double startEnergy, double reaction_fraction) const
+	{
+		return GetEnergyLoss(GetProjectile(projectile), false, Path::Beam, startEnergy, 0.0, reaction_fraction);
+	}
+
+	double Target::GetEjectileEnergyLoss(ProjectileHandle projectile, double startEnergy, double theta, double reaction_fraction) const
+	{
+		return GetEnergyLoss(GetProjectile(projectile), false, Path::Ejectile, startEnergy, theta, reaction_fraction);
+	}
+
+	void Target::GetBeamEnergyLossBatch(ProjectileHandle projectile, const double* startEnergy, const double* reaction_fraction, double* loss, size_t n) const
+	{
+		GetEnergyLossBatch(GetProjectile(projectile), false, Path::Beam, startEnergy, nullptr, reaction_fraction, loss, n);
+	}
+
+	void Target::GetEjectileEnergyLossBatch(ProjectileHandle projectile, const double* startEnergy, const double* theta, const double* reaction_fraction,
+											double* loss, size_t n) const
 	{
-		m_params.ZP = zp;
-		m_params.massP = MassLookup::GetInstance().FindMass(zp, ap)*EnergyLoss::mev2u;
+		GetEnergyLossBatch(GetProjectile(projectile), false, Path::Ejectile, startEnergy, theta, reaction_fraction, loss, n);
+	}
 
-		if(theta == M_PI/2.) 
-			return finalEnergy;
-		else if (theta > M_PI/2.) 
-			theta = M_PI - theta;
+	/*Calculates energy loss for travelling all the way through the target*/
+	double Target::GetEnergyLossTotal(int zp, int ap, double startEnergy, double theta) const
+	{
+		Projectile scratch;
+		return GetEnergyLoss(GetProjectile(zp, ap, scratch), false, Path::Stack, startEnergy, theta, 1.0);
+	}
 
-		m_params.energy = finalEnergy;
-		m_params.thickness = m_totalThickness/(std::fabs(std::cos(theta)));
+	/*Calculates the energy loss for traveling some fraction through the target*/
+	double Target::GetEnergyLossFractionalDepth(int zp, int ap, double startEnergy, double theta, double percent_depth) const
+	{
+		Projectile scratch;
+		return GetEnergyLoss(GetProjectile(zp, ap, scratch), false, Path::Stack, startEnergy, theta, percent_depth);
+	}
 
-		return EnergyLoss::GetReverseEnergyLoss(m_params);
+	/*Calculates reverse energy loss for travelling all the way through the target*/
+	double Target::GetReverseEnergyLossTotal(int zp, int ap, double finalEnergy, double theta) const
+	{
+		Projectile scratch;
+		return GetEnergyLoss(GetProjectile(zp, ap, scratch), true, Path::Stack, finalEnergy, theta, 1.0);
 	}
 
 	/*Calculates the reverse energy loss for traveling some fraction through the target*/
-	double Target::GetReverseEnergyLossFractionalDepth(int zp, int ap, double finalEnergy, double theta, double percent_depth)
+	double Target::GetReverseEnergyLossFractionalDepth(int zp, int ap, double finalEnergy, double theta, double percent_depth) const
+	{
+		Projectile scratch;
+		return GetEnergyLoss(GetProjectile(zp, ap, scratch), true, Path::Stack, finalEnergy, theta, percent_depth);
+	}
+
+	void Target::GetEnergyLossBatch(int zp, int ap, const double* startEnergy, const double* theta, const double* percent_depth, double* loss, size_t n) const
+	{
+		Projectile scratch;
+		GetEnergyLossBatch(GetProjectile(zp, ap, scratch), false, Path::Stack, startEnergy, theta, percent_depth, loss, n);
+	}
+
+	void Target::GetReverseEnergyLossBatch(int zp, int ap, const double* finalEnergy, const double* theta, const double* percent_depth, double* loss, size_t n) const
 	{
-		m_params.ZP = zp;
-		m_params.massP = MassLookup::GetInstance().FindMass(zp, ap)*EnergyLoss::mev2u;
+		Projectile scratch;
+		GetEnergyLossBatch(GetProjectile(zp, ap, scratch), true, Path::Stack, finalEnergy, theta, percent_depth, loss, n);
+	}
 
+	/*
+		Energy loss (or reverse energy loss) along a straight path through the target in the direction theta. A particle
+		moving parallel to the target (theta = pi/2) loses all of its energy. The layers are crossed one after the other, each
+		with its own stopping power; a particle which stops in a layer loses all of its energy. Reverse energy loss walks the
+		path backwards, from the energy at its end.
+	*/
+	double Target::GetEnergyLoss(const Projectile& projectile, bool reverse, Path path, double energy, double theta, double fraction) const
+	{
+		double start, end;
+		GetPathDepths(path, fraction, theta, start, end);
 		if(theta == M_PI/2.)
-			return finalEnergy;
+			return energy;
 		else if (theta > M_PI/2.)
 			theta = M_PI-theta;
 
-		m_params.energy = finalEnergy;
-		m_params.thickness = m_totalThickness*percent_depth/(std::fabs(std::cos(theta)));
+		double cosTheta = std::fabs(std::cos(theta));
+		double total = 0.0;
+		for(size_t k=0; k<m_layers.size(); k++)
+		{
+			size_t index = GetLayerOnPath(k, start, end, reverse);
+			double overlap = GetOverlap(m_layers[index], start, end);
+			if(!(overlap > 0.0))
+				continue;
+
+			double current = reverse ? energy + total : energy - total;
+			double loss = GetLayerEnergyLoss(projectile, index, reverse, current, overlap/cosTheta);
+			if(!reverse && loss >= current)
+				return energy;
+			total += loss;
+		}
+		return total;
+	}
+
+	double Target::GetLayerEnergyLoss(const Projectile& projectile, size_t layer, bool reverse, double energy, double thickness) const
+	{
+		const EnergyLoss::Parameters& params = projectile.layers[layer].params;
+		if(reverse)
+			return EnergyLoss::GetReverseEnergyLoss(params, energy, thickness);
+		if(EnergyLossCache::IsEnabled())
+			return GetCachedEnergyLoss(projectile, layer, energy, thickness);
+		return EnergyLoss::GetEnergyLoss(params, energy, thickness);
+	}
+
+	/*
+		Energy loss from the cache (see EnergyLossCache.h): bilinear in (log(E), x) between the losses at the four surrounding
+		nodes. Energies the range table can serve are not cached, the table is already exact and cheaper than four lookups.
+		Near the end of the range the loss is not smooth (a stopped particle loses all of its energy), so if any of the nodes
+		is stopped the loss is integrated directly.
+	*/
+	double Target::GetCachedEnergyLoss(const Projectile& projectile, size_t layer, double startEnergy, double thickness) const
+	{
+		const EnergyLoss::Parameters& params = projectile.layers[layer].params;
+		if(thickness == 0.0 || !(startEnergy > 0.0) || params.ZP == 0 || (params.table && params.table->IsInTable(startEnergy)))
+			return EnergyLoss::GetEnergyLoss(params, startEnergy, thickness);
+
+		double q = EnergyLossCache::GetQuantization();
+		double thicknessStep = q*m_layers[layer].thickness;
+		double u = std::log(startEnergy)/q;
+		double v = thickness/thicknessStep;
+		double iFloor = std::floor(u);
+		double jFloor = std::floor(v);
+		double fu = u - iFloor;
+		double fv = v - jFloor;
+
+		EnergyLossCache::Key key;
+		key.target = m_layers[layer].cacheID;
+		key.Z = projectile.Z;
+		key.A = projectile.A;
+		double nodeLoss[2][2];
+		for(int i=0; i<2; i++)
+		{
+			key.energyNode = static_cast<int64_t>(iFloor) + i;
+			double nodeEnergy = std::exp(key.energyNode*q);
+			for(int j=0; j<2; j++)
+			{
+				key.thicknessNode = static_cast<int64_t>(jFloor) + j;
+				double nodeThickness = key.thicknessNode*thicknessStep;
+				nodeLoss[i][j] = EnergyLossCache::FindNode(key, [&]() { return EnergyLoss::GetEnergyLoss(params, nodeEnergy, nodeThickness); });
+				if(nodeLoss[i][j] >= nodeEnergy)
+					return EnergyLoss::GetEnergyLoss(params, startEnergy, thickness);
+			}
+		}
+
+		return (1.0 - fu)*((1.0 - fv)*nodeLoss[0][0] + fv*nodeLoss[0][1]) + fu*((1.0 - fv)*nodeLoss[1][0] + fv*nodeLoss[1][1]);
+	}
+
+	/*
+		Same results as the single particle functions. The batch is walked in blocks, and each block a layer at a time (the
+		kth layer each particle crosses): first the path lengths and the ranges of the whole block (straight loops over the
+		columns), then the inversion of the range tables. Particles the table cannot handle (outside of its energies, or a
+		species without a table) go through the single particle integration.
+	*/
+	void Target::GetEnergyLossBatch(const Projectile& projectile, bool reverse, Path path, const double* energy, const double* theta,
+									const double* fraction, double* loss, size_t n) const
+	{
+		double start[s_batchBlock];
+		double end[s_batchBlock];
+		double cosTheta[s_batchBlock];
+		bool active[s_batchBlock];
+		size_t layer[s_batchBlock];
+		double thickness[s_batchBlock];
+		double current[s_batchBlock];
+		double range[s_batchBlock];
+		for(size_t first=0; first<n; first += s_batchBlock)
+		{
+			size_t nblock = std::min(s_batchBlock, n - first);
+			const double* e = energy + first;
+			const double* f = fraction + first;
+			double* out = loss + first;
+
+			//A particle moving parallel to the target (as for the single particle functions) loses it all
+			for(size_t i=0; i<nblock; i++)
+			{
+				double angle = theta ? theta[first + i] : 0.0;
+				GetPathDepths(path, f[i], angle, start[i], end[i]);
+				if(angle > M_PI/2.)
+					angle = M_PI - angle;
+				cosTheta[i] = std::fabs(std::cos(angle));
+				active[i] = angle != M_PI/2.;
+				out[i] = active[i] ? 0.0 : e[i];
+			}
+
+			for(size_t k=0; k<m_layers.size(); k++)
+			{
+				for(size_t i=0; i<nblock; i++)
+				{
+					layer[i] = GetLayerOnPath(k, start[i], end[i], reverse);
+					double overlap = GetOverlap(m_layers[layer[i]], start[i], end[i]);
+					thickness[i] = active[i] && overlap > 0.0 ? overlap/cosTheta[i] : 0.0;
+					current[i] = reverse ? e[i] + out[i] : e[i] - out[i];
+				}
+
+				for(size_t i=0; i<nblock; i++)
+				{
+					const StoppingTable* table = projectile.layers[layer[i]].params.table;
+					range[i] = thickness[i] > 0.0 && table != nullptr && table->IsInTable(current[i]) ? table->GetRange(current[i]) : -1.0;
+				}
+
+				uint64_t ntable = 0;
+				for(size_t i=0; i<nblock; i++)
+				{
+					if(thickness[i] == 0.0)
+						continue;
+
+					const EnergyLoss::Parameters& params = projectile.layers[layer[i]].params;
+					const StoppingTable* table = params.table;
+					double layerLoss;
+					if(current[i] == 0.0 || params.ZP == 0)
+						layerLoss = 0.0;
+					else if(range[i] >= 0.0 && EnergyLoss::TableEnergyLoss(*table, range[i], current[i], thickness[i], reverse, layerLoss))
+						ntable++;
+					else
+						layerLoss = GetLayerEnergyLoss(projectile, layer[i], reverse, current[i], thickness[i]);
 
-		return EnergyLoss::GetReverseEnergyLoss(m_params);
+					if(!reverse && layerLoss >= current[i])
+					{
+						out[i] = e[i];
+						active[i] = false;
+					}
+					else
+						out[i] += layerLoss;
+				}
+				EnergyLoss::CountTableLookups(ntable);
+			}
+		}
 	}
 
 }
@@ -9,13 +9,22 @@ Based on code by D.W. Visser written at Yale for the original SPANC
 
 Written by G.W. McCann Aug. 2020
 
+A target may also be a stack of layers (e.g. a 10B foil on a carbon backing), ordered from upstream to downstream, each a
+compound of its own with its own thickness. Depths are areal densities (ug/cm^2) measured from the upstream face of the
+stack. Reactions happen in one of the layers (the reaction layer); particles leaving the reaction point lose energy in
+the rest of that layer and then in every layer they cross, each with its own range tables.
+
 */
 #ifndef TARGET_H
 #define TARGET_H
 
 #include <string>
 #include <vector>
+#include <memory>
+#include <algorithm>
 #include "EnergyLoss.h"
+#include "StoppingTable.h"
+#include "EnergyLossCache.h"
 
 namespace NucKage {
 
@@ -23,26 +32,137 @@ namespace NucKage {
 	{
 
 	public:
+		//A projectile species registered with RegisterProjectile. Valid for the target which handed it out and for copies of
+		//that target, until the target material is changed with SetParameters or AddLayer.
+		class ProjectileHandle
+		{
+		public:
+			inline bool IsValid() const { return m_index >= 0; }
+
+		private:
+			friend class Target;
+			int m_index = -1;
+		};
+
 		Target();
 	 	Target(const std::vector<int>& z, const std::vector<int>& stoich, double thick);
 	 	~Target();
 
+	 	//A single layer target, or the first layer of a stack
 	 	void SetParameters(const std::vector<int>& z, const std::vector<int>& stoich, double thick);
-	 	double GetEnergyLossTotal(int zp, int ap, double startEnergy, double angle);
-	 	double GetReverseEnergyLossTotal(int zp, int ap, double finalEnergy, double angle);
-	 	double GetEnergyLossFractionalDepth(int zp, int ap, double startEnergy, double angle, double percent_depth);
-	 	double GetReverseEnergyLossFractionalDepth(int zp, int ap, double finalEnergy, double angle, double percent_depth);
+	 	//Another layer downstream of the ones already there
+	 	void AddLayer(const std::vector<int>& z, const std::vector<int>& stoich, double thick);
+	 	void SetReactionLayer(size_t layer);
+	 	int FindLayer(int z) const;
+	 	ProjectileHandle RegisterProjectile(int zp, int ap);
+
+	 	//Energy loss of a registered species: no lookup of the projectile per call
+	 	double GetEnergyLossTotal(ProjectileHandle projectile, double startEnergy, double angle) const;
+	 	double GetReverseEnergyLossTotal(ProjectileHandle projectile, double finalEnergy, double angle) const;
+	 	double GetEnergyLossFractionalDepth(ProjectileHandle projectile, double startEnergy, double angle, double percent_depth) const;
+	 	double GetReverseEnergyLossFractionalDepth(ProjectileHandle projectile, double finalEnergy, double angle, double percent_depth) const;
+	 	//Fractional depth energy loss of n particles of one species, theta may be null for normal incidence
+	 	void GetEnergyLossBatch(ProjectileHandle projectile, const double* startEnergy, const double* theta, const double* percent_depth, double* loss, size_t n) const;
+	 	void GetReverseEnergyLossBatch(ProjectileHandle projectile, const double* finalEnergy, const double* theta, const double* percent_depth, double* loss, size_t n) const;
 
-	 	inline const EnergyLoss::Parameters& GetParameters() const { return m_params; }
+	 	//Energy loss between the upstream face and the reaction point at reaction_fraction of the reaction layer (normal
+	 	//incidence), and from the reaction point out of the target along theta (backwards for theta > pi/2)
+	 	double GetBeamEnergyLoss(ProjectileHandle projectile, double startEnergy, double reaction_fraction) const;
+	 	double GetEjectileEnergyLoss(ProjectileHandle projectile, double startEnergy, double angle, double reaction_fraction) const;
+	 	void GetBeamEnergyLossBatch(ProjectileHandle projectile, const double* startEnergy, const double* reaction_fraction, double* loss, size_t n) const;
+	 	void GetEjectileEnergyLossBatch(ProjectileHandle projectile, const double* startEnergy, const double* theta, const double* reaction_fraction,
+	 									double* loss, size_t n) const;
+
+	 	//Energy loss of any species, registered or not
+	 	double GetEnergyLossTotal(int zp, int ap, double startEnergy, double angle) const;
+	 	double GetReverseEnergyLossTotal(int zp, int ap, double finalEnergy, double angle) const;
+	 	double GetEnergyLossFractionalDepth(int zp, int ap, double startEnergy, double angle, double percent_depth) const;
+	 	double GetReverseEnergyLossFractionalDepth(int zp, int ap, double finalEnergy, double angle, double percent_depth) const;
+	 	void GetEnergyLossBatch(int zp, int ap, const double* startEnergy, const double* theta, const double* percent_depth, double* loss, size_t n) const;
+	 	void GetReverseEnergyLossBatch(int zp, int ap, const double* finalEnergy, const double* theta, const double* percent_depth, double* loss, size_t n) const;
+
+	 	//Target material of a layer only
+	 	inline const EnergyLoss::Parameters& GetParameters(size_t layer = 0) const { return layer < m_layers.size() ? m_layers[layer].params : s_noParameters; }
 	 	inline const double GetTotalThickness() const { return m_totalThickness; }
-	 	inline const bool IsValid() { return m_isValid; }
-	
+	 	inline const bool IsValid() const { return m_isValid; }
+	 	inline size_t GetNumberOfLayers() const { return m_layers.size(); }
+	 	inline size_t GetReactionLayer() const { return m_reactionLayer; }
+	 	size_t GetNumberOfTables() const;
+
+	 	//Role file option energyloss_tables. With tables off, registered species are integrated (or served by the energy loss
+	 	//cache) like species which were never registered. Takes effect for a species the next time it is registered.
+	 	inline static void SetUseRangeTables(bool use) { s_useRangeTables = use; }
+	 	inline static bool GetUseRangeTables() { return s_useRangeTables; }
+
 	private:
-		EnergyLoss::Parameters m_params;
+		struct Layer
+		{
+			EnergyLoss::Parameters params; //target material only
+			double depth; //of the upstream face
+			double thickness;
+			uint32_t cacheID; //identifies the material and thickness in the energy loss cache, shared by copies
+		};
+
+		//The projectile in one layer: the parameters of the layer with the projectile (mass, charge coefficients) and its table
+		struct LayerProjectile
+		{
+			EnergyLoss::Parameters params;
+			std::shared_ptr<const StoppingTable> table;
+		};
+
+		//A species, one entry per layer
+		struct Projectile
+		{
+			int Z = 0;
+			int A = 0;
+			bool tabulated = false; //range tables built, as the setting was when the species was last registered
+			std::vector<LayerProjectile> layers;
+		};
+
+		//Straight paths through the stack: from the upstream face to percent_depth of the whole stack, from the upstream face
+		//to the reaction point, and from the reaction point out of the target
+		enum class Path
+		{
+			Stack,
+			Beam,
+			Ejectile
+		};
+
+		int FindProjectile(int zp, int ap) const;
+		void SetProjectile(Projectile& projectile, int zp, int ap) const;
+		void SetTables(Projectile& projectile) const;
+		//Stand-in for an invalid handle: the target material with no projectile, which loses no energy
+		inline const Projectile& GetProjectile(ProjectileHandle handle) const { return handle.IsValid() ? m_projectiles[handle.m_index] : m_noProjectile; }
+		const Projectile& GetProjectile(int zp, int ap, Projectile& scratch) const;
+		void GetPathDepths(Path path, double fraction, double theta, double& start, double& end) const;
+		//Index of the layer crossed in the kth place on the path from start to end (from end to start in reverse)
+		inline size_t GetLayerOnPath(size_t k, double start, double end, bool reverse) const { return (end >= start) != reverse ? k : m_layers.size() - 1 - k; }
+		//Thickness of layer between the depths start and end
+		inline double GetOverlap(const Layer& layer, double start, double end) const
+		{
+			return std::min(std::max(start, end), layer.depth + layer.thickness) - std::max(std::min(start, end), layer.depth);
+		}
+
+		double GetEnergyLoss(const Projectile& projectile, bool reverse, Path path, double energy, double theta, double fraction) const;
+		double GetLayerEnergyLoss(const Projectile& projectile, size_t layer, bool reverse, double energy, double thickness) const;
+		double GetCachedEnergyLoss(const Projectile& projectile, size_t layer, double startEnergy, double thickness) const;
+		void GetEnergyLossBatch(const Projectile& projectile, bool reverse, Path path, const double* energy, const double* theta,
+								const double* fraction, double* loss, size_t n) const;
+
+		static constexpr size_t s_batchBlock = 256; //particles per pass over the range table in the batch functions
+
+		std::vector<Layer> m_layers;
+		std::vector<Projectile> m_projectiles;
+		Projectile m_noProjectile;
+		size_t m_reactionLayer;
 		double m_totalThickness;
 		bool m_isValid;
+
+		static std::atomic<uint32_t> s_nextCacheID;
+		static bool s_useRangeTables;
+		static const EnergyLoss::Parameters s_noParameters;
 	};
 
 }
 
-#endif 
+#endif
@@ -0,0 +1,123 @@
+#ifndef EVENT_BLOCK_H
+#define EVENT_BLOCK_H
+
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <cmath>
+#include "NameTable.h"
+
+namespace NucKage {
+
+	/*
+		Structure-of-arrays storage for a block of events from a single chain. Every particle slot of every reactor
+		is a set of contiguous columns (one entry per event), so each stage of the simulation (sampling, kinematics,
+		energy loss, detection, plotting) can run as a tight loop over arrays. Everything that is the same for every
+		event (isotopes, masses, names) is stored once per slot, not once per event.
+	*/
+
+	//Four-vectors and detector results of one particle slot
+	struct ParticleColumns
+	{
+		std::vector<double> px;
+		std::vector<double> py;
+		std::vector<double> pz;
+		std::vector<double> E;
+		std::vector<uint8_t> detected;
+		std::vector<int> detectorID;
+		std::vector<int> detectorFrontChannel;
+		std::vector<int> detectorBackChannel;
+		std::vector<double> rho;
+
+		void Resize(size_t n)
+		{
+			px.resize(n);
+			py.resize(n);
+			pz.resize(n);
+			E.resize(n);
+			detected.resize(n);
+			detectorID.resize(n);
+			detectorFrontChannel.resize(n);
+			detectorBackChannel.resize(n);
+			rho.resize(n);
+		}
+
+		inline double P(size_t i) const { return std::sqrt(px[i]*px[i] + py[i]*py[i] + pz[i]*pz[i]); }
+		inline double M(size_t i) const
+		{
+			double m2 = E[i]*E[i] - (px[i]*px[i] + py[i]*py[i] + pz[i]*pz[i]);
+			return m2 < 0.0 ? -std::sqrt(-m2) : std::sqrt(m2);
+		}
+		inline double Theta(size_t i) const
+		{
+			double perp = std::sqrt(px[i]*px[i] + py[i]*py[i]);
+			return perp == 0.0 && pz[i] == 0.0 ? 0.0 : std::atan2(perp, pz[i]);
+		}
+		inline double Phi(size_t i) const { return px[i] == 0.0 && py[i] == 0.0 ? 0.0 : std::atan2(py[i], px[i]); }
+	};
+
+	//Per-slot information which is constant over the block
+	struct SlotInfo
+	{
+		bool active=false;
+		int Z=0;
+		int A=0;
+		double mass=0.0;
+		NameID symbol=NameTable::s_noName;
+	};
+
+	//Sampled parameters and products of one reactor in the chain
+	struct ReactorColumns
+	{
+		enum Slot
+		{
+			Target=0,
+			Projectile=1,
+			Ejectile=2,
+			Residual=3,
+			NSlots=4
+		};
+
+		NameID reactor=NameTable::s_noName;
+		std::array<SlotInfo, NSlots> info;
+		std::array<ParticleColumns, NSlots> particles;
+
+		std::vector<double> beamEnergy;
+		std::vector<double> excitation;
+		std::vector<double> directionX; //CM ejectile direction
+		std::vector<double> directionY;
+		std::vector<double> directionZ;
+		std::vector<uint8_t> valid; //0 if the reaction/decay was not energetically allowed for this event (or for a parent)
+
+		void Resize(size_t n)
+		{
+			for(auto& particle : particles)
+				particle.Resize(n);
+			beamEnergy.resize(n);
+			excitation.resize(n);
+			directionX.resize(n);
+			directionY.resize(n);
+			directionZ.resize(n);
+			valid.resize(n);
+		}
+	};
+
+	struct EventBlock
+	{
+		int chainID=-1;
+		size_t size=0;
+		std::vector<double> targetFraction; //location of the reaction in the target, shared by the whole chain
+		std::vector<ReactorColumns> reactors;
+
+		void Resize(size_t nreactors, size_t n)
+		{
+			size = n;
+			targetFraction.resize(n);
+			reactors.resize(nreactors);
+			for(auto& reactor : reactors)
+				reactor.Resize(n);
+		}
+	};
+}
+
+#endif
@@ -9,67 +9,64 @@ Written by G.W. McCann Aug. 2020
 
 */
 #include "MassLookup.h"
+#include "MassTable.h"
 #include <iostream>
 
 namespace NucKage {
 
-	MassLookup* MassLookup::s_instance = new MassLookup();
-	
-	MassLookup::MassLookup()
-	{
-		std::ifstream massfile("etc/mass.txt");
-		if(massfile.is_open())
+	namespace {
+
+		//Nuclear masses in MeV indexed by [Z][A] (zero where the mass file has no entry), and the element symbols by Z
+		struct MassArray
 		{
-			std::string junk, A, element;
-			int Z;
-			double atomicMassBig, atomicMassSmall, isotopicMass;
-			getline(massfile,junk);
-			getline(massfile,junk);
-			while(massfile>>junk)
+			double mass[MassTable::maxZ + 1][MassTable::maxA + 1];
+			const char* symbol[MassTable::maxZ + 1];
+		};
+
+		constexpr MassArray BuildMassArray()
+		{
+			MassArray array{};
+			for(const auto& entry : MassTable::entries)
 			{
-				massfile>>Z>>A>>element>>atomicMassBig>>atomicMassSmall;
-				isotopicMass = (atomicMassBig + atomicMassSmall*1e-6 - Z*electron_mass)*u_to_mev;
-				std::string key = "("+std::to_string(Z)+","+A+")";
-				massTable[key] = isotopicMass;
-				elementTable[Z] = element;
+				array.mass[entry.Z][entry.A] = (entry.atomicMassBig + entry.atomicMassSmall*1e-6 - entry.Z*MassLookup::electron_mass)*MassLookup::u_to_mev;
+				array.symbol[entry.Z] = entry.element;
 			}
+			return array;
 		}
-		else
-		{
-			std::cerr<<"ERR -- Unable to open mass file, check etc directory"<<std::endl;
-		}
+
+		constexpr MassArray s_masses = BuildMassArray();
+
 	}
+
+	MassLookup* MassLookup::s_instance = new MassLookup();
+	
+	MassLookup::MassLookup() {}
 	
 	MassLookup::~MassLookup() {}
 	
 	//Returns nuclear mass in MeV
-	double MassLookup::FindMass(int Z, int A)
+	double MassLookup::FindMass(int Z, int A) const
 	{
-		std::lock_guard<std::mutex> guard(m_massMutex);
-		std::string key = "("+std::to_string(Z)+","+std::to_string(A)+")";
-		auto data = massTable.find(key);
-		if(data == massTable.end())
+		if(Z < 0 || Z > MassTable::maxZ || A < 0 || A > MassTable::maxA || s_masses.mass[Z][A] == 0.0)
 		{
 			std::cerr<<"WARN -- Unable to find mass of (Z,A)=("<<Z<<","<<A<<")."<<std::endl;
 			return 0.0;
 		}
 	
-		return data->second;
+		return s_masses.mass[Z][A];
 	}
 	
 	//returns element symbol
-	std::string MassLookup::FindSymbol(int Z, int A)
+	std::string MassLookup::FindSymbol(int Z, int A) const
 	{
-		std::lock_guard<std::mutex> guard(m_massMutex);
-		auto data = elementTable.find(Z);
-		if(data == elementTable.end())
+		if(Z < 0 || Z > MassTable::maxZ || s_masses.symbol[Z] == nullptr)
 		{
 			std::cerr<<"WARN -- Unable to find symbol of (Z,A)=("<<Z<<","<<A<<")."<<std::endl;
 			return "";
 		}
 	
-		std::string fullsymbol = std::to_string(A) + data->second;
+		std::string fullsymbol = std::to_string(A) + s_masses.symbol[Z];
 		return fullsymbol;
 	}
 
-}
\ No newline at end of file
+}
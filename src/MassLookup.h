@@ -8,14 +8,15 @@ of this map (MASS) for use throughout code it is included into.
 Written by G.W. McCann Aug. 2020
 
 Converted to true singleton to simplify usage -- Aug. 2021 GWM
+
+The masses are compiled in (see MassTable.h, generated from etc/mass.txt) as a flat
+[Z][A] array built at compile time, so there is no file to read at startup and
+lookups are a plain indexed load with no locking.
 */
 #ifndef MASS_LOOKUP_H
 #define MASS_LOOKUP_H
 
-#include <fstream>
 #include <string>
-#include <unordered_map>
-#include <mutex>
 
 namespace NucKage {
 
@@ -24,22 +25,17 @@ namespace NucKage {
 	public:
 		MassLookup();
 		~MassLookup();
-		double FindMass(int Z, int A);
-		std::string FindSymbol(int Z, int A);
+		double FindMass(int Z, int A) const;
+		std::string FindSymbol(int Z, int A) const;
 	
 		inline static MassLookup& GetInstance() { return *s_instance; }
-	
-	private:
-		static MassLookup* s_instance;
-		std::unordered_map<std::string, double> massTable;
-		std::unordered_map<int, std::string> elementTable;
 
-		std::mutex m_massMutex;
-	
 		//constants
 		static constexpr double u_to_mev = 931.4940954;
 		static constexpr double electron_mass = 0.000548579909;
-	    
+	
+	private:
+		static MassLookup* s_instance;
 	};
 
 }
@@ -0,0 +1,2531 @@
+/*
+
+MassTable.h
+Generated from etc/mass.txt by premake5.lua, do not edit. Atomic masses from the AMDC, as in the mass file: the
+integer part in u and the remainder in micro-u. Used by MassLookup to build its table at compile time.
+
+*/
+#ifndef MASS_TABLE_H
+#define MASS_TABLE_H
+
+namespace NucKage {
+
+	namespace MassTable {
+
+		struct Entry
+		{
+			int Z;
+			int A;
+			const char* element;
+			double atomicMassBig; //u
+			double atomicMassSmall; //micro-u
+		};
+
+		constexpr int maxZ = 110;
+		constexpr int maxA = 270;
+
+		constexpr Entry entries[] = {
+			{0, 1, "n", 1, 8664.91582},
+			{1, 1, "H", 1, 7825.03224},
+			{1, 2, "H", 2, 14101.77811},
+			{1, 3, "H", 3, 16049.28199},
+			{2, 3, "He", 3, 16029.32265},
+			{1, 4, "H", 4, 26431.868},
+			{2, 4, "He", 4, 2603.25413},
+			{3, 4, "Li", 4, 27185.562},
+			{1, 5, "H", 5, 35311.493},
+			{2, 5, "He", 5, 12057.224},
+			{3, 5, "Li", 5, 12537.800},
+			{1, 6, "H", 6, 44955.437},
+			{2, 6, "He", 6, 18885.891},
+			{3, 6, "Li", 6, 15122.88742},
+			{4, 6, "Be", 6, 19726.409},
+			{2, 7, "He", 7, 27990.654},
+			{3, 7, "Li", 7, 16003.43666},
+			{4, 7, "Be", 7, 16928.717},
+			{5, 7, "B", 7, 29712.000},
+			{2, 8, "He", 8, 33934.390},
+			{3, 8, "Li", 8, 22486.246},
+			{4, 8, "Be", 8, 5305.102},
+			{5, 8, "B", 8, 24607.316},
+			{6, 8, "C", 8, 37643.042},
+			{2, 9, "He", 9, 43946.419},
+			{3, 9, "Li", 9, 26790.191},
+			{4, 9, "Be", 9, 12183.066},
+			{5, 9, "B", 9, 13329.649},
+			{6, 9, "C", 9, 31037.207},
+			{2, 10, "He", 10, 52815.308},
+			{3, 10, "Li", 10, 35483.453},
+			{4, 10, "Be", 10, 13534.695},
+			{5, 10, "B", 10, 12936.862},
+			{6, 10, "C", 10, 16853.218},
+			{7, 10, "N", 10, 41653.543},
+			{3, 11, "Li", 11, 43723.581},
+			{4, 11, "Be", 11, 21661.081},
+			{5, 11, "B", 11, 9305.166},
+			{6, 11, "C", 11, 11432.597},
+			{7, 11, "N", 11, 26090.945},
+			{3, 12, "Li", 12, 52613.941},
+			{4, 12, "Be", 12, 26922.083},
+			{5, 12, "B", 12, 14352.638},
+			{6, 12, "C", 12, 0.0},
+			{7, 12, "N", 12, 18613.182},
+			{8, 12, "O", 12, 34261.747},
+			{3, 13, "Li", 13, 61171.503},
+			{4, 13, "Be", 13, 36134.507},
+			{5, 13, "B", 13, 17779.981},
+			{6, 13, "C", 13, 3354.83521},
+			{7, 13, "N", 13, 5738.609},
+			{8, 13, "O", 13, 24815.437},
+			{4, 14, "Be", 14, 42892.920},
+			{5, 14, "B", 14, 25404.012},
+			{6, 14, "C", 14, 3241.98843},
+			{7, 14, "N", 14, 3074.00446},
+			{8, 14, "O", 14, 8596.706},
+			{9, 14, "F", 14, 34315.199},
+			{4, 15, "Be", 15, 53490.215},
+			{5, 15, "B", 15, 31087.953},
+			{6, 15, "C", 15, 10599.256},
+			{7, 15, "N", 15, 108.89894},
+			{8, 15, "O", 15, 3065.618},
+			{9, 15, "F", 15, 17785.139},
+			{10, 15, "Ne", 15, 43172.980},
+			{4, 16, "Be", 16, 61672.036},
+			{5, 16, "B", 16, 39841.920},
+			{6, 16, "C", 16, 14701.256},
+			{7, 16, "N", 16, 6101.925},
+			{8, 16, "O", 15, 994914.61960},
+			{9, 16, "F", 16, 11465.723},
+			{10, 16, "Ne", 16, 25750.864},
+			{5, 17, "B", 17, 46931.399},
+			{6, 17, "C", 17, 22578.672},
+			{7, 17, "N", 17, 8448.877},
+			{8, 17, "O", 16, 999131.75664},
+			{9, 17, "F", 17, 2095.238},
+			{10, 17, "Ne", 17, 17713.959},
+			{11, 17, "Na", 17, 37760.000},
+			{5, 18, "B", 18, 55601.682},
+			{6, 18, "C", 18, 26751.932},
+			{7, 18, "N", 18, 14077.565},
+			{8, 18, "O", 17, 999159.61284},
+			{9, 18, "F", 18, 937.325},
+			{10, 18, "Ne", 18, 5708.693},
+			{11, 18, "Na", 18, 26879.386},
+			{5, 19, "B", 19, 64166.000},
+			{6, 19, "C", 19, 34797.596},
+			{7, 19, "N", 19, 17022.419},
+			{8, 19, "O", 19, 3577.970},
+			{9, 19, "F", 18, 998403.16288},
+			{10, 19, "Ne", 19, 1880.903},
+			{11, 19, "Na", 19, 13880.272},
+			{12, 19, "Mg", 19, 34169.182},
+			{6, 20, "C", 20, 40261.732},
+			{7, 20, "N", 20, 23367.295},
+			{8, 20, "O", 20, 4075.358},
+			{9, 20, "F", 19, 999981.252},
+			{10, 20, "Ne", 19, 992440.17619},
+			{11, 20, "Na", 20, 7354.426},
+			{12, 20, "Mg", 20, 18763.075},
+			{7, 21, "N", 21, 27087.573},
+			{8, 21, "O", 21, 8654.950},
+			{9, 21, "F", 20, 999948.894},
+			{10, 21, "Ne", 20, 993846.685},
+			{11, 21, "Na", 20, 997654.702},
+			{12, 21, "Mg", 21, 11705.764},
+			{6, 22, "C", 22, 57553.990},
+			{7, 22, "N", 22, 34100.918},
+			{8, 22, "O", 22, 9965.746},
+			{9, 22, "F", 22, 2998.809},
+			{10, 22, "Ne", 21, 991385.109},
+			{11, 22, "Na", 21, 994437.418},
+			{12, 22, "Mg", 21, 999570.654},
+			{7, 23, "N", 23, 39421.000},
+			{8, 23, "O", 23, 15696.686},
+			{9, 23, "F", 23, 3526.874},
+			{10, 23, "Ne", 22, 994466.900},
+			{11, 23, "Na", 22, 989769.28199},
+			{12, 23, "Mg", 22, 994123.941},
+			{13, 23, "Al", 23, 7244.351},
+			{8, 24, "O", 24, 19861.000},
+			{9, 24, "F", 24, 8099.370},
+			{10, 24, "Ne", 23, 993610.645},
+			{11, 24, "Na", 23, 990963.011},
+			{12, 24, "Mg", 23, 985041.697},
+			{13, 24, "Al", 23, 999947.541},
+			{14, 24, "Si", 24, 11535.441},
+			{8, 25, "O", 25, 29338.919},
+			{9, 25, "F", 25, 12167.727},
+			{10, 25, "Ne", 24, 997814.799},
+			{11, 25, "Na", 24, 989953.973},
+			{12, 25, "Mg", 24, 985836.964},
+			{13, 25, "Al", 24, 990428.306},
+			{14, 25, "Si", 25, 4108.801},
+			{8, 26, "O", 26, 37210.155},
+			{9, 26, "F", 26, 20020.392},
+			{10, 26, "Ne", 26, 516.496},
+			{11, 26, "Na", 25, 992634.649},
+			{12, 26, "Mg", 25, 982592.971},
+			{13, 26, "Al", 25, 986891.863},
+			{14, 26, "Si", 25, 992333.804},
+			{9, 27, "F", 27, 27322.000},
+			{10, 27, "Ne", 27, 7569.462},
+			{11, 27, "Na", 26, 994076.408},
+			{12, 27, "Mg", 26, 984340.628},
+			{13, 27, "Al", 26, 981538.408},
+			{14, 27, "Si", 26, 986704.688},
+			{15, 27, "P", 26, 999224.409},
+			{9, 28, "F", 28, 36223.095},
+			{10, 28, "Ne", 28, 12130.767},
+			{11, 28, "Na", 27, 998939.000},
+			{12, 28, "Mg", 27, 983876.606},
+			{13, 28, "Al", 27, 981910.087},
+			{14, 28, "Si", 27, 976926.53499},
+			{15, 28, "P", 27, 992326.585},
+			{16, 28, "S", 28, 4372.766},
+			{9, 29, "F", 29, 43103.000},
+			{10, 29, "Ne", 29, 19753.000},
+			{11, 29, "Na", 29, 2877.092},
+			{12, 29, "Mg", 28, 988617.393},
+			{13, 29, "Al", 28, 980453.164},
+			{14, 29, "Si", 28, 976494.66525},
+			{15, 29, "P", 28, 981800.368},
+			{16, 29, "S", 28, 996611.448},
+			{17, 29, "Cl", 29, 14130.178},
+			{10, 30, "Ne", 30, 24992.235},
+			{11, 30, "Na", 30, 9097.932},
+			{12, 30, "Mg", 29, 990462.826},
+			{13, 30, "Al", 29, 982968.388},
+			{14, 30, "Si", 29, 973770.136},
+			{15, 30, "P", 29, 978313.489},
+			{16, 30, "S", 29, 984906.769},
+			{18, 30, "Ar", 30, 22470.511},
+			{10, 31, "Ne", 31, 33474.816},
+			{11, 31, "Na", 31, 13146.656},
+			{12, 31, "Mg", 30, 996648.232},
+			{13, 31, "Al", 30, 983949.756},
+			{14, 31, "Si", 30, 975363.194},
+			{15, 31, "P", 30, 973761.99863},
+			{16, 31, "S", 30, 979557.007},
+			{17, 31, "Cl", 30, 992448.098},
+			{11, 32, "Na", 32, 20011.026},
+			{12, 32, "Mg", 31, 999110.139},
+			{13, 32, "Al", 31, 988084.339},
+			{14, 32, "Si", 31, 974151.539},
+			{15, 32, "P", 31, 973907.643},
+			{16, 32, "S", 31, 972071.17443},
+			{17, 32, "Cl", 31, 985684.637},
+			{18, 32, "Ar", 31, 997637.826},
+			{11, 33, "Na", 33, 25529.000},
+			{12, 33, "Mg", 33, 5327.245},
+			{13, 33, "Al", 32, 990877.687},
+			{14, 33, "Si", 32, 977976.964},
+			{15, 33, "P", 32, 971725.694},
+			{16, 33, "S", 32, 971458.90985},
+			{17, 33, "Cl", 32, 977451.989},
+			{18, 33, "Ar", 32, 989925.547},
+			{11, 34, "Na", 34, 34010.000},
+			{12, 34, "Mg", 34, 8935.481},
+			{13, 34, "Al", 33, 996779.057},
+			{14, 34, "Si", 33, 978575.437},
+			{15, 34, "P", 33, 973645.887},
+			{16, 34, "S", 33, 967867.012},
+			{17, 34, "Cl", 33, 973762.491},
+			{18, 34, "Ar", 33, 980270.093},
+			{12, 35, "Mg", 35, 16790.000},
+			{13, 35, "Al", 34, 999759.817},
+			{14, 35, "Si", 34, 984550.134},
+			{15, 35, "P", 34, 973314.053},
+			{16, 35, "S", 34, 969032.322},
+			{17, 35, "Cl", 34, 968852.694},
+			{18, 35, "Ar", 34, 975257.721},
+			{19, 35, "K", 34, 988005.407},
+			{12, 36, "Mg", 36, 21879.000},
+			{13, 36, "Al", 36, 6388.000},
+			{14, 36, "Si", 35, 986649.271},
+			{15, 36, "P", 35, 978259.619},
+			{16, 36, "S", 35, 967080.699},
+			{17, 36, "Cl", 35, 968306.822},
+			{18, 36, "Ar", 35, 967545.105},
+			{19, 36, "K", 35, 981302.010},
+			{20, 36, "Ca", 35, 993074.406},
+			{12, 37, "Mg", 37, 30286.265},
+			{13, 37, "Al", 37, 10531.000},
+			{14, 37, "Si", 36, 992945.191},
+			{15, 37, "P", 36, 979606.956},
+			{16, 37, "S", 36, 971125.507},
+			{17, 37, "Cl", 36, 965902.584},
+			{18, 37, "Ar", 36, 966776.314},
+			{19, 37, "K", 36, 973375.889},
+			{20, 37, "Ca", 36, 985897.852},
+			{13, 38, "Al", 38, 17402.000},
+			{14, 38, "Si", 37, 995523.000},
+			{15, 38, "P", 37, 984303.105},
+			{16, 38, "S", 37, 971163.310},
+			{17, 38, "Cl", 37, 968010.418},
+			{18, 38, "Ar", 37, 962732.104},
+			{19, 38, "K", 37, 969081.116},
+			{20, 38, "Ca", 37, 976319.226},
+			{14, 39, "Si", 39, 2491.000},
+			{15, 39, "P", 38, 986285.865},
+			{16, 39, "S", 38, 975133.852},
+			{17, 39, "Cl", 38, 968008.162},
+			{18, 39, "Ar", 38, 964313.039},
+			{19, 39, "K", 38, 963706.48661},
+			{20, 39, "Ca", 38, 970710.813},
+			{21, 39, "Sc", 38, 984784.970},
+			{14, 40, "Si", 40, 5829.000},
+			{15, 40, "P", 39, 991288.865},
+			{16, 40, "S", 39, 975482.562},
+			{17, 40, "Cl", 39, 970415.469},
+			{18, 40, "Ar", 39, 962383.12378},
+			{19, 40, "K", 39, 963998.166},
+			{20, 40, "Ca", 39, 962590.865},
+			{21, 40, "Sc", 39, 977967.292},
+			{22, 40, "Ti", 39, 990498.721},
+			{14, 41, "Si", 41, 13011.000},
+			{15, 41, "P", 40, 994654.000},
+			{16, 41, "S", 40, 979593.451},
+			{17, 41, "Cl", 40, 970684.525},
+			{18, 41, "Ar", 40, 964500.571},
+			{19, 41, "K", 40, 961825.25796},
+			{20, 41, "Ca", 40, 962277.921},
+			{21, 41, "Sc", 40, 969251.104},
+			{22, 41, "Ti", 40, 983148.000},
+			{15, 42, "P", 42, 1084.000},
+			{16, 42, "S", 41, 981065.100},
+			{17, 42, "Cl", 41, 973342.000},
+			{18, 42, "Ar", 41, 963045.736},
+			{19, 42, "K", 41, 962402.306},
+			{20, 42, "Ca", 41, 958617.828},
+			{21, 42, "Sc", 41, 965516.522},
+			{22, 42, "Ti", 41, 973049.022},
+			{15, 43, "P", 43, 5024.000},
+			{16, 43, "S", 42, 986907.635},
+			{17, 43, "Cl", 42, 974063.700},
+			{18, 43, "Ar", 42, 965636.055},
+			{19, 43, "K", 42, 960734.703},
+			{20, 43, "Ca", 42, 958766.430},
+			{21, 43, "Sc", 42, 961150.472},
+			{22, 43, "Ti", 42, 968522.521},
+			{23, 43, "V", 42, 980766.000},
+			{16, 44, "S", 43, 990118.848},
+			{17, 44, "Cl", 43, 978116.312},
+			{18, 44, "Ar", 43, 964923.816},
+			{19, 44, "K", 43, 961586.986},
+			{20, 44, "Ca", 43, 955481.543},
+			{21, 44, "Sc", 43, 959402.867},
+			{22, 44, "Ti", 43, 959689.951},
+			{23, 44, "V", 43, 974110.000},
+			{16, 45, "S", 44, 995717.000},
+			{17, 45, "Cl", 44, 980394.353},
+			{18, 45, "Ar", 44, 968039.733},
+			{19, 45, "K", 44, 960691.493},
+			{20, 45, "Ca", 44, 956186.326},
+			{21, 45, "Sc", 44, 955907.503},
+			{22, 45, "Ti", 44, 958121.211},
+			{23, 45, "V", 44, 965768.951},
+			{24, 45, "Cr", 44, 979050.000},
+			{17, 46, "Cl", 45, 985121.323},
+			{18, 46, "Ar", 45, 968037.446},
+			{19, 46, "K", 45, 961981.586},
+			{20, 46, "Ca", 45, 953687.988},
+			{21, 46, "Sc", 45, 955167.485},
+			{22, 46, "Ti", 45, 952626.856},
+			{23, 46, "V", 45, 960197.971},
+			{24, 46, "Cr", 45, 968360.970},
+			{18, 47, "Ar", 46, 972768.114},
+			{19, 47, "K", 46, 961661.614},
+			{20, 47, "Ca", 46, 954541.394},
+			{21, 47, "Sc", 46, 952402.704},
+			{22, 47, "Ti", 46, 951757.752},
+			{23, 47, "V", 46, 954904.038},
+			{24, 47, "Cr", 46, 962895.544},
+			{25, 47, "Mn", 46, 975774.000},
+			{18, 48, "Ar", 47, 976080.000},
+			{19, 48, "K", 47, 965341.186},
+			{20, 48, "Ca", 47, 952522.904},
+			{21, 48, "Sc", 47, 952223.157},
+			{22, 48, "Ti", 47, 947940.932},
+			{23, 48, "V", 47, 952251.229},
+			{24, 48, "Cr", 47, 954028.667},
+			{25, 48, "Mn", 47, 968549.085},
+			{19, 49, "K", 48, 968210.755},
+			{20, 49, "Ca", 48, 955662.875},
+			{21, 49, "Sc", 48, 950014.423},
+			{22, 49, "Ti", 48, 947864.627},
+			{23, 49, "V", 48, 948510.746},
+			{24, 49, "Cr", 48, 951332.955},
+			{25, 49, "Mn", 48, 959612.585},
+			{26, 49, "Fe", 48, 973429.000},
+			{19, 50, "K", 49, 972380.017},
+			{20, 50, "Ca", 49, 957499.217},
+			{21, 50, "Sc", 49, 952176.415},
+			{22, 50, "Ti", 49, 944785.839},
+			{23, 50, "V", 49, 947155.845},
+			{24, 50, "Cr", 49, 946041.443},
+			{25, 50, "Mn", 49, 954237.391},
+			{26, 50, "Fe", 49, 962988.000},
+			{19, 51, "K", 50, 975827.867},
+			{20, 51, "Ca", 50, 960995.665},
+			{21, 51, "Sc", 50, 953592.095},
+			{22, 51, "Ti", 50, 946609.600},
+			{23, 51, "V", 50, 943956.867},
+			{24, 51, "Cr", 50, 944764.652},
+			{25, 51, "Mn", 50, 948208.065},
+			{26, 51, "Fe", 50, 956840.779},
+			{27, 51, "Co", 50, 970647.000},
+			{19, 52, "K", 51, 981602.000},
+			{20, 52, "Ca", 51, 963213.648},
+			{21, 52, "Sc", 51, 956582.351},
+			{22, 52, "Ti", 51, 946891.960},
+			{23, 52, "V", 51, 944772.839},
+			{24, 52, "Cr", 51, 940504.992},
+			{25, 52, "Mn", 51, 945563.488},
+			{26, 52, "Fe", 51, 948115.217},
+			{27, 52, "Co", 51, 963112.000},
+			{19, 53, "K", 52, 986800.000},
+			{20, 53, "Ca", 52, 968451.000},
+			{21, 53, "Sc", 52, 958231.821},
+			{22, 53, "Ti", 52, 949724.785},
+			{23, 53, "V", 52, 944335.593},
+			{24, 53, "Cr", 52, 940646.961},
+			{25, 53, "Mn", 52, 941287.742},
+			{26, 53, "Fe", 52, 945305.574},
+			{27, 53, "Co", 52, 954203.217},
+			{28, 53, "Ni", 52, 968190.000},
+			{20, 54, "Ca", 53, 972989.000},
+			{21, 54, "Sc", 53, 963616.620},
+			{22, 54, "Ti", 53, 951022.786},
+			{23, 54, "V", 53, 946437.472},
+			{24, 54, "Cr", 53, 938878.012},
+			{25, 54, "Mn", 53, 940356.429},
+			{26, 54, "Fe", 53, 939608.306},
+			{27, 54, "Co", 53, 948459.192},
+			{28, 54, "Ni", 53, 957833.000},
+			{21, 55, "Sc", 54, 967622.601},
+			{22, 55, "Ti", 54, 955267.465},
+			{23, 55, "V", 54, 947241.114},
+			{24, 55, "Cr", 54, 940837.289},
+			{25, 55, "Mn", 54, 938043.172},
+			{26, 55, "Fe", 54, 938291.283},
+			{27, 55, "Co", 54, 941996.531},
+			{28, 55, "Ni", 54, 951329.961},
+			{29, 55, "Cu", 54, 966038.000},
+			{21, 56, "Sc", 55, 973320.000},
+			{22, 56, "Ti", 55, 957788.190},
+			{23, 56, "V", 55, 950450.694},
+			{24, 56, "Cr", 55, 940649.107},
+			{25, 56, "Mn", 55, 938902.947},
+			{26, 56, "Fe", 55, 934935.617},
+			{27, 56, "Co", 55, 939838.150},
+			{28, 56, "Ni", 55, 942127.872},
+			{29, 56, "Cu", 55, 958515.000},
+			{21, 57, "Sc", 56, 977460.000},
+			{22, 57, "Ti", 56, 963590.068},
+			{23, 57, "V", 56, 952320.197},
+			{24, 57, "Cr", 56, 943612.409},
+			{25, 57, "Mn", 56, 938285.968},
+			{26, 57, "Fe", 56, 935392.134},
+			{27, 57, "Co", 56, 936289.913},
+			{28, 57, "Ni", 56, 939791.525},
+			{29, 57, "Cu", 56, 949211.819},
+			{23, 58, "V", 57, 956626.932},
+			{24, 58, "Cr", 57, 944184.502},
+			{25, 58, "Mn", 57, 940066.646},
+			{26, 58, "Fe", 57, 933273.738},
+			{27, 58, "Co", 57, 935751.429},
+			{28, 58, "Ni", 57, 935341.780},
+			{29, 58, "Cu", 57, 944532.413},
+			{30, 58, "Zn", 57, 954590.428},
+			{23, 59, "V", 58, 959385.659},
+			{24, 59, "Cr", 58, 948377.810},
+			{25, 59, "Mn", 58, 940391.113},
+			{26, 59, "Fe", 58, 934873.649},
+			{27, 59, "Co", 58, 933193.656},
+			{28, 59, "Ni", 58, 934345.571},
+			{29, 59, "Cu", 58, 939496.844},
+			{30, 59, "Zn", 58, 949312.017},
+			{23, 60, "V", 59, 964313.290},
+			{24, 60, "Cr", 59, 949898.146},
+			{25, 60, "Mn", 59, 943136.576},
+			{26, 60, "Fe", 59, 934070.411},
+			{27, 60, "Co", 59, 933815.667},
+			{28, 60, "Ni", 59, 930785.256},
+			{29, 60, "Cu", 59, 937363.916},
+			{30, 60, "Zn", 59, 941841.450},
+			{23, 61, "V", 60, 967250.000},
+			{24, 61, "Cr", 60, 954400.963},
+			{25, 61, "Mn", 60, 944452.544},
+			{26, 61, "Fe", 60, 936746.244},
+			{27, 61, "Co", 60, 932476.145},
+			{28, 61, "Ni", 60, 931054.945},
+			{29, 61, "Cu", 60, 933457.371},
+			{30, 61, "Zn", 60, 939506.960},
+			{31, 61, "Ga", 60, 949398.859},
+			{24, 62, "Cr", 61, 956097.451},
+			{25, 62, "Mn", 61, 947907.386},
+			{26, 62, "Fe", 61, 936791.812},
+			{27, 62, "Co", 61, 934058.317},
+			{28, 62, "Ni", 61, 928344.871},
+			{29, 62, "Cu", 61, 932594.921},
+			{30, 62, "Zn", 61, 934333.477},
+			{31, 62, "Ga", 61, 944189.757},
+			{24, 63, "Cr", 62, 961344.384},
+			{25, 63, "Mn", 62, 949664.675},
+			{26, 63, "Fe", 62, 940272.700},
+			{27, 63, "Co", 62, 933599.744},
+			{28, 63, "Ni", 62, 929669.139},
+			{29, 63, "Cu", 62, 929597.236},
+			{30, 63, "Zn", 62, 933211.167},
+			{31, 63, "Ga", 62, 939294.195},
+			{32, 63, "Ge", 62, 949628.000},
+			{24, 64, "Cr", 63, 964058.000},
+			{25, 64, "Mn", 63, 953849.370},
+			{26, 64, "Fe", 63, 940987.763},
+			{27, 64, "Co", 63, 935810.291},
+			{28, 64, "Ni", 63, 927966.341},
+			{29, 64, "Cu", 63, 929763.857},
+			{30, 64, "Zn", 63, 929141.772},
+			{31, 64, "Ga", 63, 936840.365},
+			{32, 64, "Ge", 63, 941689.913},
+			{25, 65, "Mn", 64, 956019.750},
+			{26, 65, "Fe", 64, 945015.324},
+			{27, 65, "Co", 64, 936462.073},
+			{28, 65, "Ni", 64, 930084.697},
+			{29, 65, "Cu", 64, 927789.487},
+			{30, 65, "Zn", 64, 929240.532},
+			{31, 65, "Ga", 64, 932734.395},
+			{32, 65, "Ge", 64, 939368.137},
+			{33, 65, "As", 64, 949611.000},
+			{25, 66, "Mn", 65, 960546.834},
+			{26, 66, "Fe", 65, 946249.960},
+			{27, 66, "Co", 65, 939442.945},
+			{28, 66, "Ni", 65, 929139.334},
+			{29, 66, "Cu", 65, 928868.814},
+			{30, 66, "Zn", 65, 926033.704},
+			{31, 66, "Ga", 65, 931589.832},
+			{32, 66, "Ge", 65, 933862.126},
+			{33, 66, "As", 65, 944148.779},
+			{26, 67, "Fe", 66, 951035.482},
+			{27, 67, "Co", 66, 940609.628},
+			{28, 67, "Ni", 66, 931569.414},
+			{29, 67, "Cu", 66, 927729.526},
+			{30, 67, "Zn", 66, 927127.482},
+			{31, 67, "Ga", 66, 928202.384},
+			{32, 67, "Ge", 66, 932733.620},
+			{33, 67, "As", 66, 939251.111},
+			{34, 67, "Se", 66, 949994.000},
+			{26, 68, "Fe", 67, 953314.875},
+			{27, 68, "Co", 67, 944250.135},
+			{28, 68, "Ni", 67, 931868.789},
+			{29, 68, "Cu", 67, 929610.889},
+			{30, 68, "Zn", 67, 924844.291},
+			{31, 68, "Ga", 67, 927980.221},
+			{32, 68, "Ge", 67, 928095.308},
+			{33, 68, "As", 67, 936774.130},
+			{34, 68, "Se", 67, 941825.239},
+			{27, 69, "Co", 68, 946023.102},
+			{28, 69, "Ni", 68, 935610.268},
+			{29, 69, "Cu", 68, 929429.268},
+			{30, 69, "Zn", 68, 926550.418},
+			{31, 69, "Ga", 68, 925573.531},
+			{32, 69, "Ge", 68, 927964.471},
+			{33, 69, "As", 68, 932246.294},
+			{34, 69, "Se", 68, 939414.847},
+			{35, 69, "Br", 68, 950338.413},
+			{28, 70, "Ni", 69, 936431.303},
+			{29, 70, "Cu", 69, 932392.079},
+			{30, 70, "Zn", 69, 925319.181},
+			{31, 70, "Ga", 69, 926021.917},
+			{32, 70, "Ge", 69, 924248.706},
+			{33, 70, "As", 69, 930926.151},
+			{34, 70, "Se", 69, 933515.523},
+			{35, 70, "Br", 69, 944792.323},
+			{27, 71, "Co", 70, 952366.923},
+			{28, 71, "Ni", 70, 940518.964},
+			{29, 71, "Cu", 70, 932676.832},
+			{30, 71, "Zn", 70, 927719.580},
+			{31, 71, "Ga", 70, 924702.536},
+			{32, 71, "Ge", 70, 924952.284},
+			{33, 71, "As", 70, 927113.758},
+			{34, 71, "Se", 70, 932209.432},
+			{35, 71, "Br", 70, 939342.156},
+			{36, 71, "Kr", 70, 950265.696},
+			{28, 72, "Ni", 71, 941785.926},
+			{29, 72, "Cu", 71, 935820.307},
+			{30, 72, "Zn", 71, 926842.807},
+			{31, 72, "Ga", 71, 926367.434},
+			{32, 72, "Ge", 71, 922075.826},
+			{33, 72, "As", 71, 926752.295},
+			{34, 72, "Se", 71, 927140.507},
+			{35, 72, "Br", 71, 936594.607},
+			{36, 72, "Kr", 71, 942092.407},
+			{28, 73, "Ni", 72, 946206.683},
+			{29, 73, "Cu", 72, 936674.378},
+			{30, 73, "Zn", 72, 929582.582},
+			{31, 73, "Ga", 72, 925174.682},
+			{32, 73, "Ge", 72, 923458.956},
+			{33, 73, "As", 72, 923829.089},
+			{34, 73, "Se", 72, 926754.883},
+			{35, 73, "Br", 72, 931671.621},
+			{36, 73, "Kr", 72, 939289.195},
+			{29, 74, "Cu", 73, 939874.862},
+			{30, 74, "Zn", 73, 929407.262},
+			{31, 74, "Ga", 73, 926945.726},
+			{32, 74, "Ge", 73, 921177.762},
+			{33, 74, "As", 73, 923928.598},
+			{34, 74, "Se", 73, 922475.935},
+			{35, 74, "Br", 73, 929910.281},
+			{36, 74, "Kr", 73, 933084.017},
+			{37, 74, "Rb", 73, 944265.868},
+			{29, 75, "Cu", 74, 941522.606},
+			{30, 75, "Zn", 74, 932840.246},
+			{31, 75, "Ga", 74, 926500.246},
+			{32, 75, "Ge", 74, 922858.371},
+			{33, 75, "As", 74, 921594.562},
+			{34, 75, "Se", 74, 922522.871},
+			{35, 75, "Br", 74, 925810.570},
+			{36, 75, "Kr", 74, 930945.746},
+			{37, 75, "Rb", 74, 938573.201},
+			{38, 75, "Sr", 74, 949952.770},
+			{29, 76, "Cu", 75, 945275.025},
+			{30, 76, "Zn", 75, 933114.957},
+			{31, 76, "Ga", 75, 928827.625},
+			{32, 76, "Ge", 75, 921402.726},
+			{33, 76, "As", 75, 922392.010},
+			{34, 76, "Se", 75, 919213.704},
+			{35, 76, "Br", 75, 924541.577},
+			{36, 76, "Kr", 75, 925910.726},
+			{37, 76, "Rb", 75, 935073.032},
+			{38, 76, "Sr", 75, 941762.761},
+			{30, 77, "Zn", 76, 936887.199},
+			{31, 77, "Ga", 76, 929154.300},
+			{32, 77, "Ge", 76, 923549.844},
+			{33, 77, "As", 76, 920647.564},
+			{34, 77, "Se", 76, 919914.150},
+			{35, 77, "Br", 76, 921379.194},
+			{36, 77, "Kr", 76, 924670.000},
+			{37, 77, "Rb", 76, 930401.600},
+			{38, 77, "Sr", 76, 937945.455},
+			{29, 78, "Cu", 77, 952230.000},
+			{30, 78, "Zn", 77, 938289.205},
+			{31, 78, "Ga", 77, 931608.845},
+			{32, 78, "Ge", 77, 922852.912},
+			{33, 78, "As", 77, 921827.795},
+			{34, 78, "Se", 77, 917309.243},
+			{35, 78, "Br", 77, 921145.859},
+			{36, 78, "Kr", 77, 920366.341},
+			{37, 78, "Rb", 77, 928141.868},
+			{38, 78, "Sr", 77, 932179.980},
+			{30, 79, "Zn", 78, 942638.068},
+			{31, 79, "Ga", 78, 932852.301},
+			{32, 79, "Ge", 78, 925360.129},
+			{33, 79, "As", 78, 920948.445},
+			{34, 79, "Se", 78, 918499.251},
+			{35, 79, "Br", 78, 918337.601},
+			{36, 79, "Kr", 78, 920082.945},
+			{37, 79, "Rb", 78, 923989.864},
+			{38, 79, "Sr", 78, 929707.664},
+			{39, 79, "Y", 78, 937930.000},
+			{30, 80, "Zn", 79, 944552.930},
+			{31, 80, "Ga", 79, 936420.774},
+			{32, 80, "Ge", 79, 925350.774},
+			{33, 80, "As", 79, 922474.548},
+			{34, 80, "Se", 79, 916521.785},
+			{35, 80, "Br", 79, 918529.810},
+			{36, 80, "Kr", 79, 916378.048},
+			{37, 80, "Rb", 79, 922516.444},
+			{38, 80, "Sr", 79, 924517.540},
+			{39, 80, "Y", 79, 934354.755},
+			{30, 81, "Zn", 80, 950402.619},
+			{31, 81, "Ga", 80, 938133.842},
+			{32, 81, "Ge", 80, 928832.942},
+			{33, 81, "As", 80, 922132.290},
+			{34, 81, "Se", 80, 917993.044},
+			{35, 81, "Br", 80, 916288.206},
+			{36, 81, "Kr", 80, 916589.714},
+			{37, 81, "Rb", 80, 918993.927},
+			{38, 81, "Sr", 80, 923211.394},
+			{39, 81, "Y", 80, 929454.283},
+			{40, 81, "Zr", 80, 938314.000},
+			{30, 82, "Zn", 81, 954574.099},
+			{31, 82, "Ga", 81, 943176.533},
+			{32, 82, "Ge", 81, 929774.033},
+			{33, 82, "As", 81, 924738.733},
+			{34, 82, "Se", 81, 916699.537},
+			{35, 82, "Br", 81, 916801.760},
+			{36, 82, "Kr", 81, 913481.15520},
+			{37, 82, "Rb", 81, 918209.024},
+			{38, 82, "Sr", 81, 918399.847},
+			{39, 82, "Y", 81, 926930.188},
+			{40, 82, "Zr", 81, 931689.000},
+			{31, 83, "Ga", 82, 947120.301},
+			{32, 83, "Ge", 82, 934539.101},
+			{33, 83, "As", 82, 925206.901},
+			{34, 83, "Se", 82, 919118.609},
+			{35, 83, "Br", 82, 915175.289},
+			{36, 83, "Kr", 82, 914126.518},
+			{37, 83, "Rb", 82, 915114.182},
+			{38, 83, "Sr", 82, 917554.374},
+			{39, 83, "Y", 82, 922484.025},
+			{40, 83, "Zr", 82, 929240.925},
+			{41, 83, "Nb", 82, 938211.000},
+			{32, 84, "Ge", 83, 937575.091},
+			{33, 84, "As", 83, 929303.291},
+			{34, 84, "Se", 83, 918466.762},
+			{35, 84, "Br", 83, 916496.419},
+			{36, 84, "Kr", 83, 911497.72863},
+			{37, 84, "Rb", 83, 914375.225},
+			{38, 84, "Sr", 83, 913419.120},
+			{39, 84, "Y", 83, 920671.061},
+			{40, 84, "Zr", 83, 923325.662},
+			{41, 84, "Nb", 83, 934279.000},
+			{32, 85, "Ge", 84, 942969.659},
+			{33, 85, "As", 84, 932163.659},
+			{34, 85, "Se", 84, 922260.759},
+			{35, 85, "Br", 84, 915645.759},
+			{36, 85, "Kr", 84, 912527.262},
+			{37, 85, "Rb", 84, 911789.73760},
+			{38, 85, "Sr", 84, 912932.043},
+			{39, 85, "Y", 84, 916433.039},
+			{40, 85, "Zr", 84, 921443.198},
+			{41, 85, "Nb", 84, 928845.837},
+			{42, 85, "Mo", 84, 938260.737},
+			{32, 86, "Ge", 85, 946967.000},
+			{33, 86, "As", 85, 936701.533},
+			{34, 86, "Se", 85, 924311.733},
+			{35, 86, "Br", 85, 918805.433},
+			{36, 86, "Kr", 85, 910610.62627},
+			{37, 86, "Rb", 85, 911167.443},
+			{38, 86, "Sr", 85, 909260.72631},
+			{39, 86, "Y", 85, 914886.098},
+			{40, 86, "Zr", 85, 916296.815},
+			{41, 86, "Nb", 85, 925781.535},
+			{42, 86, "Mo", 85, 931174.817},
+			{33, 87, "As", 86, 940291.718},
+			{34, 87, "Se", 86, 928688.618},
+			{35, 87, "Br", 86, 920674.018},
+			{36, 87, "Kr", 86, 913354.759},
+			{37, 87, "Rb", 86, 909180.531},
+			{38, 87, "Sr", 86, 908877.49615},
+			{39, 87, "Y", 86, 910876.102},
+			{40, 87, "Zr", 86, 914817.339},
+			{41, 87, "Nb", 86, 920692.472},
+			{42, 87, "Mo", 86, 928196.201},
+			{43, 87, "Tc", 86, 938067.187},
+			{34, 88, "Se", 87, 931417.491},
+			{35, 88, "Br", 87, 924083.291},
+			{36, 88, "Kr", 87, 914447.881},
+			{37, 88, "Rb", 87, 911315.591},
+			{38, 88, "Sr", 87, 905612.25561},
+			{39, 88, "Y", 87, 909501.276},
+			{40, 88, "Zr", 87, 910220.709},
+			{41, 88, "Nb", 87, 918224.287},
+			{42, 88, "Mo", 87, 921967.781},
+			{43, 88, "Tc", 87, 933782.381},
+			{34, 89, "Se", 88, 936669.059},
+			{35, 89, "Br", 88, 926704.559},
+			{36, 89, "Kr", 88, 917835.450},
+			{37, 89, "Rb", 88, 912278.137},
+			{38, 89, "Sr", 88, 907450.808},
+			{39, 89, "Y", 88, 905841.205},
+			{40, 89, "Zr", 88, 908882.332},
+			{41, 89, "Nb", 88, 913445.272},
+			{42, 89, "Mo", 88, 919468.150},
+			{43, 89, "Tc", 88, 927648.650},
+			{34, 90, "Se", 89, 940096.000},
+			{35, 90, "Br", 89, 931292.850},
+			{36, 90, "Kr", 89, 919527.930},
+			{37, 90, "Rb", 89, 914798.803},
+			{38, 90, "Sr", 89, 907730.885},
+			{39, 90, "Y", 89, 907144.800},
+			{40, 90, "Zr", 89, 904698.758},
+			{41, 90, "Nb", 89, 911259.204},
+			{42, 90, "Mo", 89, 913931.272},
+			{43, 90, "Tc", 89, 924073.921},
+			{44, 90, "Ru", 89, 930344.379},
+			{34, 91, "Se", 90, 945700.000},
+			{35, 91, "Br", 90, 934398.618},
+			{36, 91, "Kr", 90, 923806.310},
+			{37, 91, "Rb", 90, 916537.265},
+			{38, 91, "Sr", 90, 910195.958},
+			{39, 91, "Y", 90, 907298.066},
+			{40, 91, "Zr", 90, 905640.223},
+			{41, 91, "Nb", 90, 906990.274},
+			{42, 91, "Mo", 90, 911745.195},
+			{43, 91, "Tc", 90, 918424.975},
+			{44, 91, "Ru", 90, 926741.532},
+			{35, 92, "Br", 91, 939631.597},
+			{36, 92, "Kr", 91, 926173.094},
+			{37, 92, "Rb", 91, 919728.481},
+			{38, 92, "Sr", 91, 911038.224},
+			{39, 92, "Y", 91, 908945.745},
+			{40, 92, "Zr", 91, 905035.322},
+			{41, 92, "Nb", 91, 907188.568},
+			{42, 92, "Mo", 91, 906807.155},
+			{43, 92, "Tc", 91, 915269.779},
+			{44, 92, "Ru", 91, 920234.375},
+			{45, 92, "Rh", 91, 932367.694},
+			{35, 93, "Br", 92, 943220.000},
+			{36, 93, "Kr", 92, 931147.174},
+			{37, 93, "Rb", 92, 922039.325},
+			{38, 93, "Sr", 92, 914024.311},
+			{39, 93, "Y", 92, 909578.422},
+			{40, 93, "Zr", 92, 906470.646},
+			{41, 93, "Nb", 92, 906373.161},
+			{42, 93, "Mo", 92, 906808.773},
+			{43, 93, "Tc", 92, 910245.149},
+			{44, 93, "Ru", 92, 917104.444},
+			{45, 93, "Rh", 92, 925912.781},
+			{36, 94, "Kr", 93, 934140.454},
+			{37, 94, "Rb", 93, 926394.818},
+			{38, 94, "Sr", 93, 915355.643},
+			{39, 94, "Y", 93, 911592.063},
+			{40, 94, "Zr", 93, 906312.524},
+			{41, 94, "Nb", 93, 907278.992},
+			{42, 94, "Mo", 93, 905083.592},
+			{43, 94, "Tc", 93, 909652.325},
+			{44, 94, "Ru", 93, 911342.863},
+			{45, 94, "Rh", 93, 921730.453},
+			{46, 94, "Pd", 93, 929036.292},
+			{36, 95, "Kr", 94, 939710.923},
+			{37, 95, "Rb", 94, 929262.568},
+			{38, 95, "Sr", 94, 919355.840},
+			{39, 95, "Y", 94, 912818.711},
+			{40, 95, "Zr", 94, 908040.267},
+			{41, 95, "Nb", 94, 906831.115},
+			{42, 95, "Mo", 94, 905837.442},
+			{43, 95, "Tc", 94, 907652.287},
+			{44, 95, "Ru", 94, 910404.420},
+			{45, 95, "Rh", 94, 915897.895},
+			{46, 95, "Pd", 94, 924888.512},
+			{36, 96, "Kr", 95, 943016.618},
+			{37, 96, "Rb", 95, 934133.393},
+			{38, 96, "Sr", 95, 921712.692},
+			{39, 96, "Y", 95, 915902.953},
+			{40, 96, "Zr", 95, 908277.621},
+			{41, 96, "Nb", 95, 908101.591},
+			{42, 96, "Mo", 95, 904674.774},
+			{43, 96, "Tc", 95, 907866.681},
+			{44, 96, "Ru", 95, 907588.914},
+			{45, 96, "Rh", 95, 914451.710},
+			{46, 96, "Pd", 95, 918213.744},
+			{47, 96, "Ag", 95, 930743.906},
+			{36, 97, "Kr", 96, 949088.784},
+			{37, 97, "Rb", 96, 937177.118},
+			{38, 97, "Sr", 96, 926374.776},
+			{39, 97, "Y", 96, 918280.286},
+			{40, 97, "Zr", 96, 910957.386},
+			{41, 97, "Nb", 96, 908098.414},
+			{42, 97, "Mo", 96, 906016.903},
+			{43, 97, "Tc", 96, 906360.723},
+			{44, 97, "Ru", 96, 907545.779},
+			{45, 97, "Rh", 96, 911327.876},
+			{46, 97, "Pd", 96, 916471.987},
+			{47, 97, "Ag", 96, 923965.326},
+			{37, 98, "Rb", 97, 941632.317},
+			{38, 98, "Sr", 97, 928691.860},
+			{39, 98, "Y", 97, 922388.360},
+			{40, 98, "Zr", 97, 912735.124},
+			{41, 98, "Nb", 97, 910332.650},
+			{42, 98, "Mo", 97, 905403.608},
+			{43, 98, "Tc", 97, 907211.205},
+			{44, 98, "Ru", 97, 905286.713},
+			{45, 98, "Rh", 97, 910707.740},
+			{46, 98, "Pd", 97, 912698.337},
+			{47, 98, "Ag", 97, 921559.972},
+			{48, 98, "Cd", 97, 927389.317},
+			{37, 99, "Rb", 98, 945119.192},
+			{38, 99, "Sr", 98, 932880.511},
+			{39, 99, "Y", 98, 924154.288},
+			{40, 99, "Zr", 98, 916670.835},
+			{41, 99, "Nb", 98, 911609.371},
+			{42, 99, "Mo", 98, 907707.298},
+			{43, 99, "Tc", 98, 906249.678},
+			{44, 99, "Ru", 98, 905930.278},
+			{45, 99, "Rh", 98, 908124.690},
+			{46, 99, "Pd", 98, 911773.290},
+			{47, 99, "Ag", 98, 917645.768},
+			{48, 99, "Cd", 98, 924925.847},
+			{37, 100, "Rb", 99, 950351.731},
+			{38, 100, "Sr", 99, 935779.615},
+			{39, 100, "Y", 99, 927721.063},
+			{40, 100, "Zr", 99, 918005.444},
+			{41, 100, "Nb", 99, 914333.963},
+			{42, 100, "Mo", 99, 907467.976},
+			{43, 100, "Tc", 99, 907652.711},
+			{44, 100, "Ru", 99, 904210.452},
+			{45, 100, "Rh", 99, 908114.141},
+			{46, 100, "Pd", 99, 908520.315},
+			{47, 100, "Ag", 99, 916115.445},
+			{48, 100, "Cd", 99, 920348.820},
+			{49, 100, "In", 99, 930957.180},
+			{50, 100, "Sn", 99, 938504.196},
+			{38, 101, "Sr", 100, 940606.266},
+			{39, 101, "Y", 100, 930154.138},
+			{40, 101, "Zr", 100, 921453.110},
+			{41, 101, "Nb", 100, 915306.496},
+			{42, 101, "Mo", 100, 910337.641},
+			{43, 101, "Tc", 100, 907305.260},
+			{44, 101, "Ru", 100, 905573.075},
+			{45, 101, "Rh", 100, 906158.905},
+			{46, 101, "Pd", 100, 908284.828},
+			{47, 101, "Ag", 100, 912683.953},
+			{48, 101, "Cd", 100, 918586.211},
+			{50, 101, "Sn", 100, 935259.244},
+			{38, 102, "Sr", 101, 944004.680},
+			{39, 102, "Y", 101, 934327.889},
+			{40, 102, "Zr", 101, 923147.431},
+			{41, 102, "Nb", 101, 918083.697},
+			{42, 102, "Mo", 101, 910288.138},
+			{43, 102, "Tc", 101, 909207.275},
+			{44, 102, "Ru", 101, 904340.300},
+			{45, 102, "Rh", 101, 906834.270},
+			{46, 102, "Pd", 101, 905632.058},
+			{47, 102, "Ag", 101, 911704.540},
+			{48, 102, "Cd", 101, 914481.799},
+			{49, 102, "In", 101, 924105.916},
+			{50, 102, "Sn", 101, 930289.530},
+			{39, 103, "Y", 102, 937243.208},
+			{40, 103, "Zr", 102, 927197.240},
+			{41, 103, "Nb", 102, 919453.403},
+			{42, 103, "Mo", 102, 913085.140},
+			{43, 103, "Tc", 102, 909174.008},
+			{44, 103, "Ru", 102, 906314.833},
+			{45, 103, "Rh", 102, 905494.068},
+			{46, 103, "Pd", 102, 906110.840},
+			{47, 103, "Ag", 102, 908960.560},
+			{48, 103, "Cd", 102, 913416.923},
+			{49, 103, "In", 102, 919878.613},
+			{50, 103, "Sn", 102, 928101.962},
+			{40, 104, "Zr", 103, 929442.315},
+			{41, 104, "Nb", 103, 922899.115},
+			{42, 104, "Mo", 103, 913740.756},
+			{43, 104, "Tc", 103, 911428.905},
+			{44, 104, "Ru", 103, 905425.360},
+			{45, 104, "Rh", 103, 906645.295},
+			{46, 104, "Pd", 103, 904030.401},
+			{47, 104, "Ag", 103, 908623.725},
+			{48, 104, "Cd", 103, 909856.230},
+			{49, 104, "In", 103, 918214.540},
+			{50, 104, "Sn", 103, 923105.197},
+			{51, 104, "Sb", 103, 936474.502},
+			{39, 105, "Y", 104, 944959.000},
+			{40, 105, "Zr", 104, 934014.890},
+			{41, 105, "Nb", 104, 924942.564},
+			{42, 105, "Mo", 104, 916975.159},
+			{43, 105, "Tc", 104, 911657.952},
+			{44, 105, "Ru", 104, 907745.525},
+			{45, 105, "Rh", 104, 905687.806},
+			{46, 105, "Pd", 104, 905079.487},
+			{47, 105, "Ag", 104, 906525.607},
+			{48, 105, "Cd", 104, 909463.895},
+			{49, 105, "In", 104, 914502.324},
+			{50, 105, "Sn", 104, 921268.423},
+			{51, 105, "Sb", 104, 931276.549},
+			{52, 105, "Te", 104, 943304.508},
+			{40, 106, "Zr", 105, 937144.000},
+			{41, 106, "Nb", 105, 928927.768},
+			{42, 106, "Mo", 105, 918266.218},
+			{43, 106, "Tc", 105, 914356.697},
+			{44, 106, "Ru", 105, 907328.203},
+			{45, 106, "Rh", 105, 907285.901},
+			{46, 106, "Pd", 105, 903480.293},
+			{47, 106, "Ag", 105, 906663.507},
+			{48, 106, "Cd", 105, 906459.797},
+			{49, 106, "In", 105, 913463.603},
+			{50, 106, "Sn", 105, 916957.396},
+			{51, 106, "Sb", 105, 928637.982},
+			{52, 106, "Te", 105, 937498.526},
+			{40, 107, "Zr", 106, 941621.000},
+			{41, 107, "Nb", 106, 931589.672},
+			{42, 107, "Mo", 106, 922112.692},
+			{43, 107, "Tc", 106, 915458.485},
+			{44, 107, "Ru", 106, 909969.885},
+			{45, 107, "Rh", 106, 906747.974},
+			{46, 107, "Pd", 106, 905128.064},
+			{47, 107, "Ag", 106, 905091.531},
+			{48, 107, "Cd", 106, 906612.108},
+			{49, 107, "In", 106, 910290.071},
+			{50, 107, "Sn", 106, 915713.651},
+			{51, 107, "Sb", 106, 924150.624},
+			{52, 107, "Te", 106, 935008.356},
+			{41, 108, "Nb", 107, 936074.988},
+			{42, 108, "Mo", 107, 924040.367},
+			{43, 108, "Tc", 107, 918493.541},
+			{44, 108, "Ru", 107, 910185.841},
+			{45, 108, "Rh", 107, 908714.688},
+			{46, 108, "Pd", 107, 903891.805},
+			{47, 108, "Ag", 107, 905950.266},
+			{48, 108, "Cd", 107, 904183.587},
+			{49, 108, "In", 107, 909693.655},
+			{50, 108, "Sn", 107, 911894.292},
+			{51, 108, "Sb", 107, 922226.734},
+			{52, 108, "Te", 107, 929380.471},
+			{53, 108, "I", 107, 943478.321},
+			{41, 109, "Nb", 108, 939141.000},
+			{42, 109, "Mo", 108, 928431.106},
+			{43, 109, "Tc", 108, 920254.156},
+			{44, 109, "Ru", 108, 913323.756},
+			{45, 109, "Rh", 108, 908749.326},
+			{46, 109, "Pd", 108, 905950.574},
+			{47, 109, "Ag", 108, 904755.773},
+			{48, 109, "Cd", 108, 904986.698},
+			{49, 109, "In", 108, 907149.685},
+			{50, 109, "Sn", 108, 911292.843},
+			{51, 109, "Sb", 108, 918141.204},
+			{52, 109, "Te", 108, 927304.534},
+			{53, 109, "I", 108, 938086.025},
+			{54, 109, "Xe", 108, 950434.948},
+			{41, 110, "Nb", 109, 943843.000},
+			{42, 110, "Mo", 109, 930710.680},
+			{43, 110, "Tc", 109, 923741.312},
+			{44, 110, "Ru", 109, 914038.548},
+			{45, 110, "Rh", 109, 911079.742},
+			{46, 110, "Pd", 109, 905172.868},
+			{47, 110, "Ag", 109, 906110.719},
+			{48, 110, "Cd", 109, 903007.460},
+			{49, 110, "In", 109, 907170.665},
+			{50, 110, "Sn", 109, 907844.835},
+			{51, 110, "Sb", 109, 916854.286},
+			{52, 110, "Te", 109, 922458.104},
+			{53, 110, "I", 109, 935089.033},
+			{54, 110, "Xe", 109, 944258.765},
+			{42, 111, "Mo", 110, 935652.016},
+			{43, 111, "Tc", 110, 925899.016},
+			{44, 111, "Ru", 110, 917567.616},
+			{45, 111, "Rh", 110, 911642.531},
+			{46, 111, "Pd", 110, 907690.347},
+			{47, 111, "Ag", 110, 905296.816},
+			{48, 111, "Cd", 110, 904183.766},
+			{49, 111, "In", 110, 905107.233},
+			{50, 111, "Sn", 110, 907741.126},
+			{51, 111, "Sb", 110, 913218.189},
+			{52, 111, "Te", 110, 921000.589},
+			{53, 111, "I", 110, 930269.239},
+			{54, 111, "Xe", 110, 941603.989},
+			{43, 112, "Tc", 111, 929941.644},
+			{44, 112, "Ru", 111, 918806.972},
+			{45, 112, "Rh", 111, 914404.705},
+			{46, 112, "Pd", 111, 907329.986},
+			{47, 112, "Ag", 111, 907048.550},
+			{48, 112, "Cd", 111, 902763.883},
+			{49, 112, "In", 111, 905538.704},
+			{50, 112, "Sn", 111, 904824.877},
+			{51, 112, "Sb", 111, 912399.903},
+			{52, 112, "Te", 111, 916727.850},
+			{53, 112, "I", 111, 928004.550},
+			{54, 112, "Xe", 111, 935559.071},
+			{55, 112, "Cs", 111, 950305.341},
+			{43, 113, "Tc", 112, 932569.033},
+			{44, 113, "Ru", 112, 922846.396},
+			{45, 113, "Rh", 112, 915439.567},
+			{46, 113, "Pd", 112, 910261.267},
+			{47, 113, "Ag", 112, 906572.858},
+			{48, 113, "Cd", 112, 904408.097},
+			{49, 113, "In", 112, 904060.448},
+			{50, 113, "Sn", 112, 905175.845},
+			{51, 113, "Sb", 112, 909374.652},
+			{52, 113, "Te", 112, 915891.000},
+			{53, 113, "I", 112, 923650.064},
+			{54, 113, "Xe", 112, 933221.666},
+			{55, 113, "Cs", 112, 944428.488},
+			{43, 114, "Tc", 113, 937090.000},
+			{44, 114, "Ru", 113, 924613.780},
+			{45, 114, "Rh", 113, 918721.296},
+			{46, 114, "Pd", 113, 910368.780},
+			{47, 114, "Ag", 113, 908823.031},
+			{48, 114, "Cd", 113, 903364.990},
+			{49, 114, "In", 113, 904916.402},
+			{50, 114, "Sn", 113, 902780.132},
+			{51, 114, "Sb", 113, 909289.191},
+			{52, 114, "Te", 113, 912089.000},
+			{54, 114, "Xe", 113, 927980.331},
+			{55, 114, "Cs", 113, 941296.175},
+			{56, 114, "Ba", 113, 950718.495},
+			{43, 115, "Tc", 114, 939538.000},
+			{44, 115, "Ru", 114, 928942.393},
+			{45, 115, "Rh", 114, 920310.993},
+			{46, 115, "Pd", 114, 913658.718},
+			{47, 115, "Ag", 114, 908767.363},
+			{48, 115, "Cd", 114, 905437.417},
+			{49, 115, "In", 114, 903878.773},
+			{50, 115, "Sn", 114, 903344.697},
+			{51, 115, "Sb", 114, 906598.000},
+			{52, 115, "Te", 114, 911902.000},
+			{53, 115, "I", 114, 918048.000},
+			{54, 115, "Xe", 114, 926293.945},
+			{44, 116, "Ru", 115, 931219.193},
+			{45, 116, "Rh", 115, 924061.645},
+			{46, 116, "Pd", 115, 914297.210},
+			{47, 116, "Ag", 115, 911386.812},
+			{48, 116, "Cd", 115, 904763.230},
+			{49, 116, "In", 115, 905259.992},
+			{50, 116, "Sn", 115, 901742.824},
+			{51, 116, "Sb", 115, 906792.583},
+			{52, 116, "Te", 115, 908460.000},
+			{53, 116, "I", 115, 916808.658},
+			{54, 116, "Xe", 115, 921581.112},
+			{44, 117, "Ru", 116, 936135.000},
+			{45, 117, "Rh", 116, 926035.623},
+			{46, 117, "Pd", 116, 917954.944},
+			{47, 117, "Ag", 116, 911773.974},
+			{48, 117, "Cd", 116, 907226.038},
+			{49, 117, "In", 116, 904515.712},
+			{50, 117, "Sn", 116, 902954.017},
+			{51, 117, "Sb", 116, 904841.535},
+			{52, 117, "Te", 116, 908646.313},
+			{53, 117, "I", 116, 913648.314},
+			{54, 117, "Xe", 116, 920358.760},
+			{55, 117, "Cs", 116, 928616.726},
+			{56, 117, "Ba", 116, 938316.561},
+			{45, 118, "Rh", 117, 930340.443},
+			{46, 118, "Pd", 117, 919066.847},
+			{47, 118, "Ag", 117, 914595.487},
+			{48, 118, "Cd", 117, 906921.955},
+			{49, 118, "In", 117, 906356.659},
+			{50, 118, "Sn", 117, 901606.609},
+			{51, 118, "Sb", 117, 905532.174},
+			{52, 118, "Te", 117, 905853.839},
+			{53, 118, "I", 117, 913074.000},
+			{54, 118, "Xe", 117, 916178.680},
+			{55, 118, "Cs", 117, 926559.519},
+			{45, 119, "Rh", 118, 932556.952},
+			{46, 119, "Pd", 118, 923340.459},
+			{47, 119, "Ag", 118, 915570.293},
+			{48, 119, "Cd", 118, 909846.903},
+			{49, 119, "In", 118, 905850.944},
+			{50, 119, "Sn", 118, 903311.216},
+			{51, 119, "Sb", 118, 903945.512},
+			{52, 119, "Te", 118, 906407.148},
+			{53, 119, "I", 118, 910074.000},
+			{54, 119, "Xe", 118, 915410.713},
+			{55, 119, "Cs", 118, 922377.330},
+			{56, 119, "Ba", 118, 930659.686},
+			{46, 120, "Pd", 119, 924551.258},
+			{47, 120, "Ag", 119, 918784.767},
+			{48, 120, "Cd", 119, 909868.067},
+			{49, 120, "In", 119, 907966.805},
+			{50, 120, "Sn", 119, 902201.873},
+			{51, 120, "Sb", 119, 905079.624},
+			{52, 120, "Te", 119, 904059.514},
+			{53, 120, "I", 119, 910087.465},
+			{54, 120, "Xe", 119, 911784.270},
+			{55, 120, "Cs", 119, 920677.279},
+			{56, 120, "Ba", 119, 926045.000},
+			{45, 121, "Rh", 120, 939613.000},
+			{46, 121, "Pd", 120, 928950.343},
+			{47, 121, "Ag", 120, 920125.282},
+			{48, 121, "Cd", 120, 912963.663},
+			{49, 121, "In", 120, 907851.286},
+			{50, 121, "Sn", 120, 904242.792},
+			{51, 121, "Sb", 120, 903810.093},
+			{52, 121, "Te", 120, 904942.488},
+			{53, 121, "I", 120, 907405.255},
+			{54, 121, "Xe", 120, 911453.014},
+			{55, 121, "Cs", 120, 917227.238},
+			{56, 121, "Ba", 120, 924052.289},
+			{46, 122, "Pd", 121, 930631.694},
+			{47, 122, "Ag", 121, 923664.448},
+			{48, 122, "Cd", 121, 913459.052},
+			{49, 122, "In", 121, 910280.966},
+			{50, 122, "Sn", 121, 903444.001},
+			{51, 122, "Sb", 121, 905168.074},
+			{52, 122, "Te", 121, 903043.434},
+			{53, 122, "I", 121, 907588.820},
+			{54, 122, "Xe", 121, 908367.658},
+			{55, 122, "Cs", 121, 916108.145},
+			{56, 122, "Ba", 121, 919904.000},
+			{46, 123, "Pd", 122, 935126.000},
+			{47, 123, "Ag", 122, 925337.062},
+			{48, 123, "Cd", 122, 916892.453},
+			{49, 123, "In", 122, 910433.826},
+			{50, 123, "Sn", 122, 905725.446},
+			{51, 123, "Sb", 122, 904214.016},
+			{52, 123, "Te", 122, 904269.747},
+			{53, 123, "I", 122, 905588.520},
+			{54, 123, "Xe", 122, 908481.750},
+			{55, 123, "Cs", 122, 912996.062},
+			{56, 123, "Ba", 122, 918781.062},
+			{47, 124, "Ag", 123, 928931.229},
+			{48, 124, "Cd", 123, 917657.363},
+			{49, 124, "In", 123, 913182.263},
+			{50, 124, "Sn", 123, 905276.692},
+			{51, 124, "Sb", 123, 905935.789},
+			{52, 124, "Te", 123, 902817.064},
+			{53, 124, "I", 123, 906209.021},
+			{54, 124, "Xe", 123, 905891.588},
+			{55, 124, "Cs", 123, 912257.798},
+			{56, 124, "Ba", 123, 915093.629},
+			{57, 124, "La", 123, 924574.275},
+			{47, 125, "Ag", 124, 930735.000},
+			{48, 125, "Cd", 124, 921257.577},
+			{49, 125, "In", 124, 913604.591},
+			{50, 125, "Sn", 124, 907786.442},
+			{51, 125, "Sb", 124, 905252.987},
+			{52, 125, "Te", 124, 904429.900},
+			{53, 125, "I", 124, 904629.333},
+			{54, 125, "Xe", 124, 906394.050},
+			{55, 125, "Cs", 124, 909727.867},
+			{56, 125, "Ba", 124, 914471.843},
+			{57, 125, "La", 124, 920815.932},
+			{48, 126, "Cd", 125, 922429.127},
+			{49, 126, "In", 125, 916507.344},
+			{50, 126, "Sn", 125, 907658.836},
+			{51, 126, "Sb", 125, 907253.036},
+			{52, 126, "Te", 125, 903310.866},
+			{53, 126, "I", 125, 905623.313},
+			{54, 126, "Xe", 125, 904296.794},
+			{55, 126, "Cs", 125, 909445.655},
+			{56, 126, "Ba", 125, 911250.204},
+			{57, 126, "La", 125, 919512.667},
+			{58, 126, "Ce", 125, 923971.000},
+			{48, 127, "Cd", 126, 926196.624},
+			{49, 127, "In", 126, 917448.546},
+			{50, 127, "Sn", 126, 910390.401},
+			{51, 127, "Sb", 126, 906924.277},
+			{52, 127, "Te", 126, 905225.714},
+			{53, 127, "I", 126, 904471.838},
+			{54, 127, "Xe", 126, 905182.899},
+			{55, 127, "Cs", 126, 907417.381},
+			{56, 127, "Ba", 126, 911091.275},
+			{57, 127, "La", 126, 916375.084},
+			{58, 127, "Ce", 126, 922727.000},
+			{48, 128, "Cd", 127, 927812.857},
+			{49, 128, "In", 127, 920401.053},
+			{50, 128, "Sn", 127, 910507.197},
+			{51, 128, "Sb", 127, 909145.645},
+			{52, 128, "Te", 127, 904461.311},
+			{53, 128, "I", 127, 905808.600},
+			{54, 128, "Xe", 127, 903530.996},
+			{55, 128, "Cs", 127, 907748.648},
+			{56, 128, "Ba", 127, 908342.408},
+			{57, 128, "La", 127, 915592.123},
+			{58, 128, "Ce", 127, 918911.000},
+			{59, 128, "Pr", 127, 928791.000},
+			{48, 129, "Cd", 128, 932304.399},
+			{49, 129, "In", 128, 921805.486},
+			{50, 129, "Sn", 128, 913482.102},
+			{51, 129, "Sb", 128, 909146.696},
+			{52, 129, "Te", 128, 906596.492},
+			{53, 129, "I", 128, 904983.687},
+			{54, 129, "Xe", 128, 904780.85892},
+			{55, 129, "Cs", 128, 906065.690},
+			{56, 129, "Ba", 128, 908680.896},
+			{57, 129, "La", 128, 912694.475},
+			{58, 129, "Ce", 128, 918102.000},
+			{59, 129, "Pr", 128, 925095.000},
+			{48, 130, "Cd", 129, 934387.566},
+			{49, 130, "In", 129, 924977.288},
+			{50, 130, "Sn", 129, 913974.533},
+			{51, 130, "Sb", 129, 911662.688},
+			{52, 130, "Te", 129, 906222.747},
+			{53, 130, "I", 129, 906670.211},
+			{54, 130, "Xe", 129, 903509.349},
+			{55, 130, "Cs", 129, 906709.283},
+			{56, 130, "Ba", 129, 906320.874},
+			{57, 130, "La", 129, 912369.413},
+			{58, 130, "Ce", 129, 914736.000},
+			{59, 130, "Pr", 129, 923590.000},
+			{60, 130, "Nd", 129, 928506.000},
+			{48, 131, "Cd", 130, 940720.000},
+			{49, 131, "In", 130, 926972.122},
+			{50, 131, "Sn", 130, 917053.066},
+			{51, 131, "Sb", 130, 911989.341},
+			{52, 131, "Te", 130, 908522.211},
+			{53, 131, "I", 130, 906126.384},
+			{54, 131, "Xe", 130, 905084.136},
+			{55, 131, "Cs", 130, 905464.999},
+			{56, 131, "Ba", 130, 906941.181},
+			{57, 131, "La", 130, 910070.000},
+			{58, 131, "Ce", 130, 914429.465},
+			{59, 131, "Pr", 130, 920234.960},
+			{60, 131, "Nd", 130, 927248.020},
+			{49, 132, "In", 131, 932998.449},
+			{50, 132, "Sn", 131, 917823.902},
+			{51, 132, "Sb", 131, 914508.015},
+			{52, 132, "Te", 131, 908546.716},
+			{53, 132, "I", 131, 907993.514},
+			{54, 132, "Xe", 131, 904155.08697},
+			{55, 132, "Cs", 131, 906437.743},
+			{56, 132, "Ba", 131, 905061.098},
+			{57, 132, "La", 131, 910118.959},
+			{58, 132, "Ce", 131, 911463.846},
+			{59, 132, "Pr", 131, 919240.000},
+			{60, 132, "Nd", 131, 923321.237},
+			{50, 133, "Sn", 132, 923913.756},
+			{51, 133, "Sb", 132, 915272.130},
+			{52, 133, "Te", 132, 910963.332},
+			{53, 133, "I", 132, 907827.361},
+			{54, 133, "Xe", 132, 905910.750},
+			{55, 133, "Cs", 132, 905451.961},
+			{56, 133, "Ba", 132, 906007.325},
+			{57, 133, "La", 132, 908218.000},
+			{58, 133, "Ce", 132, 911520.402},
+			{59, 133, "Pr", 132, 916330.561},
+			{60, 133, "Nd", 132, 922348.000},
+			{61, 133, "Pm", 132, 929782.000},
+			{50, 134, "Sn", 133, 928680.433},
+			{51, 134, "Sb", 133, 920535.675},
+			{52, 134, "Te", 133, 911396.379},
+			{53, 134, "I", 133, 909775.663},
+			{54, 134, "Xe", 133, 905393.033},
+			{55, 134, "Cs", 133, 906718.503},
+			{56, 134, "Ba", 133, 904508.399},
+			{57, 134, "La", 133, 908514.011},
+			{58, 134, "Ce", 133, 908928.142},
+			{59, 134, "Pr", 133, 915696.729},
+			{60, 134, "Nd", 133, 918790.210},
+			{61, 134, "Pm", 133, 928353.000},
+			{50, 135, "Sn", 134, 934908.605},
+			{51, 135, "Sb", 134, 925184.357},
+			{52, 135, "Te", 134, 916554.718},
+			{53, 135, "I", 134, 910059.382},
+			{54, 135, "Xe", 134, 907231.661},
+			{55, 135, "Cs", 134, 905977.234},
+			{56, 135, "Ba", 134, 905688.606},
+			{57, 135, "La", 134, 906984.568},
+			{58, 135, "Ce", 134, 909160.799},
+			{59, 135, "Pr", 134, 913111.774},
+			{60, 135, "Nd", 134, 918181.320},
+			{61, 135, "Pm", 134, 924796.000},
+			{62, 135, "Sm", 134, 932520.000},
+			{51, 136, "Sb", 135, 930749.011},
+			{52, 136, "Te", 135, 920101.182},
+			{53, 136, "I", 135, 914604.695},
+			{54, 136, "Xe", 135, 907214.476},
+			{55, 136, "Cs", 135, 907311.590},
+			{56, 136, "Ba", 135, 904575.959},
+			{57, 136, "La", 135, 907634.962},
+			{58, 136, "Ce", 135, 907129.438},
+			{59, 136, "Pr", 135, 912677.532},
+			{60, 136, "Nd", 135, 914976.064},
+			{61, 136, "Pm", 135, 923595.949},
+			{62, 136, "Sm", 135, 928275.555},
+			{51, 137, "Sb", 136, 935522.522},
+			{52, 137, "Te", 136, 925599.357},
+			{53, 137, "I", 136, 918028.180},
+			{54, 137, "Xe", 136, 911557.773},
+			{55, 137, "Cs", 136, 907089.464},
+			{56, 137, "Ba", 136, 905827.375},
+			{57, 137, "La", 136, 906450.618},
+			{58, 137, "Ce", 136, 907762.596},
+			{59, 137, "Pr", 136, 910679.304},
+			{60, 137, "Nd", 136, 914562.448},
+			{61, 137, "Pm", 136, 920479.522},
+			{62, 137, "Sm", 136, 926970.517},
+			{63, 137, "Eu", 136, 935430.722},
+			{51, 138, "Sb", 137, 941792.000},
+			{52, 138, "Te", 137, 929472.454},
+			{53, 138, "I", 137, 922726.394},
+			{54, 138, "Xe", 137, 914146.271},
+			{55, 138, "Cs", 137, 911017.207},
+			{56, 138, "Ba", 137, 905247.229},
+			{57, 138, "La", 137, 907117.834},
+			{58, 138, "Ce", 137, 905988.743},
+			{59, 138, "Pr", 137, 910752.059},
+			{60, 138, "Nd", 137, 911949.717},
+			{61, 138, "Pm", 137, 919548.077},
+			{62, 138, "Sm", 137, 923243.990},
+			{63, 138, "Eu", 137, 933709.000},
+			{52, 139, "Te", 138, 935367.193},
+			{53, 139, "I", 138, 926493.403},
+			{54, 139, "Xe", 138, 918792.203},
+			{55, 139, "Cs", 138, 913363.992},
+			{56, 139, "Ba", 138, 908841.334},
+			{57, 139, "La", 138, 906358.804},
+			{58, 139, "Ce", 138, 906657.625},
+			{59, 139, "Pr", 138, 908943.270},
+			{60, 139, "Nd", 138, 911954.407},
+			{61, 139, "Pm", 138, 916799.806},
+			{62, 139, "Sm", 138, 922296.634},
+			{63, 139, "Eu", 138, 929792.310},
+			{52, 140, "Te", 139, 939262.917},
+			{53, 140, "I", 139, 931715.917},
+			{54, 140, "Xe", 139, 921645.817},
+			{55, 140, "Cs", 139, 917283.305},
+			{56, 140, "Ba", 139, 910606.666},
+			{57, 140, "La", 139, 909483.184},
+			{58, 140, "Ce", 139, 905446.424},
+			{59, 140, "Pr", 139, 909083.592},
+			{60, 140, "Nd", 139, 909544.332},
+			{61, 140, "Pm", 139, 916034.122},
+			{62, 140, "Sm", 139, 918994.717},
+			{63, 140, "Eu", 139, 928087.637},
+			{64, 140, "Gd", 139, 933674.000},
+			{65, 140, "Tb", 139, 945805.049},
+			{53, 141, "I", 140, 935666.084},
+			{54, 141, "Xe", 140, 926787.184},
+			{55, 141, "Cs", 140, 920045.086},
+			{56, 141, "Ba", 140, 914403.500},
+			{57, 141, "La", 140, 910969.222},
+			{58, 141, "Ce", 140, 908283.987},
+			{59, 141, "Pr", 140, 907658.403},
+			{60, 141, "Nd", 140, 909615.488},
+			{61, 141, "Pm", 140, 913555.084},
+			{62, 141, "Sm", 140, 918481.591},
+			{63, 141, "Eu", 140, 924931.745},
+			{64, 141, "Gd", 140, 932126.000},
+			{65, 141, "Tb", 140, 941448.000},
+			{53, 142, "I", 141, 941202.000},
+			{54, 142, "Xe", 141, 929973.098},
+			{55, 142, "Cs", 141, 924299.512},
+			{56, 142, "Ba", 141, 916432.888},
+			{57, 142, "La", 141, 914090.454},
+			{58, 142, "Ce", 141, 909249.884},
+			{59, 142, "Pr", 141, 910050.440},
+			{60, 142, "Nd", 141, 907728.895},
+			{61, 142, "Pm", 141, 912890.428},
+			{62, 142, "Sm", 141, 915204.532},
+			{63, 142, "Eu", 141, 923441.836},
+			{64, 142, "Gd", 141, 928116.000},
+			{65, 142, "Tb", 141, 939280.859},
+			{54, 143, "Xe", 142, 935369.553},
+			{55, 143, "Cs", 142, 927347.348},
+			{56, 143, "Ba", 142, 920625.150},
+			{57, 143, "La", 142, 916079.422},
+			{58, 143, "Ce", 142, 912391.630},
+			{59, 143, "Pr", 142, 910822.564},
+			{60, 143, "Nd", 142, 909819.887},
+			{61, 143, "Pm", 142, 910938.073},
+			{62, 143, "Sm", 142, 914634.821},
+			{63, 143, "Eu", 142, 920298.681},
+			{64, 143, "Gd", 142, 926750.682},
+			{65, 143, "Tb", 142, 935137.335},
+			{66, 143, "Dy", 142, 943994.335},
+			{54, 144, "Xe", 143, 938945.079},
+			{55, 144, "Cs", 143, 932075.404},
+			{56, 144, "Ba", 143, 922954.821},
+			{57, 144, "La", 143, 919645.589},
+			{58, 144, "Ce", 143, 913652.830},
+			{59, 144, "Pr", 143, 913310.750},
+			{60, 144, "Nd", 143, 910092.865},
+			{61, 144, "Pm", 143, 912596.224},
+			{62, 144, "Sm", 143, 912006.373},
+			{63, 144, "Eu", 143, 918819.517},
+			{64, 144, "Gd", 143, 922963.000},
+			{65, 144, "Tb", 143, 933045.000},
+			{66, 144, "Dy", 143, 939269.514},
+			{67, 144, "Ho", 143, 952109.714},
+			{54, 145, "Xe", 144, 944719.634},
+			{55, 145, "Cs", 144, 935528.930},
+			{56, 145, "Ba", 144, 927518.400},
+			{57, 145, "La", 144, 921808.066},
+			{58, 145, "Ce", 144, 917265.144},
+			{59, 145, "Pr", 144, 914518.033},
+			{60, 145, "Nd", 144, 912579.199},
+			{61, 145, "Pm", 144, 912755.773},
+			{62, 145, "Sm", 144, 913417.244},
+			{63, 145, "Eu", 144, 916272.668},
+			{64, 145, "Gd", 144, 921710.370},
+			{65, 145, "Tb", 144, 928729.105},
+			{66, 145, "Dy", 144, 937473.994},
+			{67, 145, "Ho", 144, 947267.394},
+			{54, 146, "Xe", 145, 948518.248},
+			{55, 146, "Cs", 145, 940621.870},
+			{56, 146, "Ba", 145, 930276.431},
+			{57, 146, "La", 145, 925871.468},
+			{58, 146, "Ce", 145, 918802.065},
+			{59, 146, "Pr", 145, 917679.549},
+			{60, 146, "Nd", 145, 913122.503},
+			{61, 146, "Pm", 145, 914702.286},
+			{62, 146, "Sm", 145, 913046.881},
+			{63, 146, "Eu", 145, 917210.909},
+			{64, 146, "Gd", 145, 918318.548},
+			{65, 146, "Tb", 145, 927252.768},
+			{66, 146, "Dy", 145, 932844.529},
+			{67, 146, "Ho", 145, 944993.506},
+			{68, 146, "Er", 145, 952418.359},
+			{55, 147, "Cs", 146, 944261.515},
+			{56, 147, "Ba", 146, 935303.900},
+			{57, 147, "La", 146, 928417.800},
+			{58, 147, "Ce", 146, 922689.903},
+			{59, 147, "Pr", 146, 919007.458},
+			{60, 147, "Nd", 146, 916106.010},
+			{61, 147, "Pm", 146, 915144.638},
+			{62, 147, "Sm", 146, 914904.064},
+			{63, 147, "Eu", 146, 916752.276},
+			{64, 147, "Gd", 146, 919100.987},
+			{65, 147, "Tb", 146, 924054.620},
+			{66, 147, "Dy", 146, 931082.715},
+			{67, 147, "Ho", 146, 940142.295},
+			{68, 147, "Er", 146, 949964.458},
+			{69, 147, "Tm", 146, 961379.890},
+			{55, 148, "Cs", 147, 949639.029},
+			{56, 148, "Ba", 147, 938170.578},
+			{57, 148, "La", 147, 932679.400},
+			{58, 148, "Ce", 147, 924424.196},
+			{59, 148, "Pr", 147, 922130.015},
+			{60, 148, "Nd", 147, 916899.093},
+			{61, 148, "Pm", 147, 917481.255},
+			{62, 148, "Sm", 147, 914829.012},
+			{63, 148, "Eu", 147, 918089.294},
+			{64, 148, "Gd", 147, 918121.503},
+			{65, 148, "Tb", 147, 924275.323},
+			{66, 148, "Dy", 147, 927149.772},
+			{67, 148, "Ho", 147, 937743.928},
+			{68, 148, "Er", 147, 944735.029},
+			{69, 148, "Tm", 147, 958384.029},
+			{56, 149, "Ba", 148, 942973.000},
+			{57, 149, "La", 148, 935351.260},
+			{58, 149, "Ce", 148, 928426.900},
+			{59, 149, "Pr", 148, 923736.100},
+			{60, 149, "Nd", 148, 920154.648},
+			{61, 149, "Pm", 148, 918341.658},
+			{62, 149, "Sm", 148, 917191.375},
+			{63, 149, "Eu", 148, 917937.086},
+			{64, 149, "Gd", 148, 919347.831},
+			{65, 149, "Tb", 148, 923253.753},
+			{66, 149, "Dy", 148, 927325.448},
+			{67, 149, "Ho", 148, 933819.672},
+			{68, 149, "Er", 148, 942306.000},
+			{57, 150, "La", 149, 939742.000},
+			{58, 150, "Ce", 149, 930384.035},
+			{59, 150, "Pr", 149, 926676.415},
+			{60, 150, "Nd", 149, 920901.525},
+			{61, 150, "Pm", 149, 920990.217},
+			{62, 150, "Sm", 149, 917282.195},
+			{63, 150, "Eu", 149, 919707.229},
+			{64, 150, "Gd", 149, 918664.066},
+			{65, 150, "Tb", 149, 923664.864},
+			{66, 150, "Dy", 149, 925593.080},
+			{67, 150, "Ho", 149, 933498.358},
+			{68, 150, "Er", 149, 937915.528},
+			{57, 151, "La", 150, 942769.000},
+			{58, 151, "Ce", 150, 934272.200},
+			{59, 151, "Pr", 150, 928309.114},
+			{60, 151, "Nd", 150, 923839.565},
+			{61, 151, "Pm", 150, 921216.817},
+			{62, 151, "Sm", 150, 919939.066},
+			{63, 151, "Eu", 150, 919856.860},
+			{64, 151, "Gd", 150, 920355.109},
+			{65, 151, "Tb", 150, 923109.001},
+			{66, 151, "Dy", 150, 926191.253},
+			{67, 151, "Ho", 150, 931698.177},
+			{68, 151, "Er", 150, 937448.567},
+			{69, 151, "Tm", 150, 945493.201},
+			{70, 151, "Yb", 150, 955402.458},
+			{59, 152, "Pr", 151, 931552.900},
+			{60, 152, "Nd", 151, 924691.509},
+			{61, 152, "Pm", 151, 923505.481},
+			{62, 152, "Sm", 151, 919739.040},
+			{63, 152, "Eu", 151, 921751.235},
+			{64, 152, "Gd", 151, 919798.822},
+			{65, 152, "Tb", 151, 924082.263},
+			{66, 152, "Dy", 151, 924725.363},
+			{67, 152, "Ho", 151, 931717.465},
+			{68, 152, "Er", 151, 935050.169},
+			{69, 152, "Tm", 151, 944476.000},
+			{70, 152, "Yb", 151, 950326.700},
+			{59, 153, "Pr", 152, 933903.532},
+			{60, 153, "Nd", 152, 927717.949},
+			{61, 153, "Pm", 152, 924156.436},
+			{62, 153, "Sm", 152, 922103.969},
+			{63, 153, "Eu", 152, 921237.043},
+			{64, 153, "Gd", 152, 921757.359},
+			{65, 153, "Tb", 152, 923441.978},
+			{66, 153, "Dy", 152, 925771.992},
+			{67, 153, "Ho", 152, 930206.632},
+			{68, 153, "Er", 152, 935084.279},
+			{69, 153, "Tm", 152, 942057.244},
+			{71, 153, "Lu", 152, 958805.054},
+			{59, 154, "Pr", 153, 937621.738},
+			{60, 154, "Nd", 153, 929333.977},
+			{61, 154, "Pm", 153, 926449.364},
+			{62, 154, "Sm", 153, 922216.164},
+			{63, 154, "Eu", 153, 922985.955},
+			{64, 154, "Gd", 153, 920873.398},
+			{65, 154, "Tb", 153, 924684.106},
+			{66, 154, "Dy", 153, 924429.028},
+			{67, 154, "Ho", 153, 930606.841},
+			{68, 154, "Er", 153, 932790.743},
+			{69, 154, "Tm", 153, 941570.067},
+			{70, 154, "Yb", 153, 946395.701},
+			{59, 155, "Pr", 154, 940509.259},
+			{60, 155, "Nd", 154, 933135.668},
+			{61, 155, "Pm", 154, 928137.024},
+			{62, 155, "Sm", 154, 924647.051},
+			{63, 155, "Eu", 154, 922900.102},
+			{64, 155, "Gd", 154, 922629.796},
+			{65, 155, "Tb", 154, 923509.921},
+			{66, 155, "Dy", 154, 925758.459},
+			{67, 155, "Ho", 154, 929103.634},
+			{68, 155, "Er", 154, 933215.684},
+			{69, 155, "Tm", 154, 939209.578},
+			{70, 155, "Yb", 154, 945783.217},
+			{71, 155, "Lu", 154, 954326.011},
+			{60, 156, "Nd", 155, 935078.868},
+			{61, 156, "Pm", 155, 931117.490},
+			{62, 156, "Sm", 155, 925538.511},
+			{63, 156, "Eu", 155, 924763.285},
+			{64, 156, "Gd", 155, 922130.562},
+			{65, 156, "Tb", 155, 924754.430},
+			{66, 156, "Dy", 155, 924284.038},
+			{67, 156, "Ho", 155, 929705.436},
+			{68, 156, "Er", 155, 931065.890},
+			{69, 156, "Tm", 155, 938985.597},
+			{70, 156, "Yb", 155, 942816.893},
+			{71, 156, "Lu", 155, 953086.606},
+			{72, 156, "Hf", 155, 959401.889},
+			{60, 157, "Nd", 156, 939386.037},
+			{61, 157, "Pm", 156, 933121.370},
+			{62, 157, "Sm", 156, 928418.673},
+			{63, 157, "Eu", 156, 925432.791},
+			{64, 157, "Gd", 156, 923967.870},
+			{65, 157, "Tb", 156, 924032.328},
+			{66, 157, "Dy", 156, 925469.667},
+			{67, 157, "Ho", 156, 928251.999},
+			{68, 157, "Er", 156, 931922.655},
+			{69, 157, "Tm", 156, 936973.000},
+			{70, 157, "Yb", 156, 942649.230},
+			{71, 157, "Lu", 156, 950144.045},
+			{73, 157, "Ta", 156, 968230.251},
+			{61, 158, "Pm", 157, 936565.121},
+			{62, 158, "Sm", 157, 929950.979},
+			{63, 158, "Eu", 157, 927798.581},
+			{64, 158, "Gd", 157, 924111.646},
+			{65, 158, "Tb", 157, 925420.166},
+			{66, 158, "Dy", 157, 924414.597},
+			{67, 158, "Ho", 157, 928944.692},
+			{68, 158, "Er", 157, 929893.474},
+			{69, 158, "Tm", 157, 936979.525},
+			{70, 158, "Yb", 157, 939870.534},
+			{71, 158, "Lu", 157, 949315.626},
+			{72, 158, "Hf", 157, 954801.222},
+			{61, 159, "Pm", 158, 939286.479},
+			{62, 159, "Sm", 158, 933217.202},
+			{63, 159, "Eu", 158, 929099.612},
+			{64, 159, "Gd", 158, 926396.267},
+			{65, 159, "Tb", 158, 925353.933},
+			{66, 159, "Dy", 158, 925746.023},
+			{67, 159, "Ho", 158, 927718.768},
+			{68, 159, "Er", 158, 930690.875},
+			{69, 159, "Tm", 158, 934975.000},
+			{70, 159, "Yb", 158, 940054.787},
+			{71, 159, "Lu", 158, 946635.615},
+			{72, 159, "Hf", 158, 953995.838},
+			{73, 159, "Ta", 158, 963028.052},
+			{62, 160, "Sm", 159, 935335.286},
+			{63, 160, "Eu", 159, 931850.916},
+			{64, 160, "Gd", 159, 927061.537},
+			{65, 160, "Tb", 159, 927174.778},
+			{66, 160, "Dy", 159, 925203.244},
+			{67, 160, "Ho", 159, 928735.204},
+			{68, 160, "Er", 159, 929077.130},
+			{69, 160, "Tm", 159, 935263.106},
+			{70, 160, "Yb", 159, 937559.763},
+			{71, 160, "Lu", 159, 946033.000},
+			{72, 160, "Hf", 159, 950682.513},
+			{73, 160, "Ta", 159, 961541.679},
+			{74, 160, "W", 159, 968516.753},
+			{62, 161, "Sm", 160, 939160.143},
+			{63, 161, "Eu", 160, 933664.066},
+			{64, 161, "Gd", 160, 929676.602},
+			{65, 161, "Tb", 160, 927577.001},
+			{66, 161, "Dy", 160, 926939.088},
+			{67, 161, "Ho", 160, 927860.759},
+			{68, 161, "Er", 160, 930003.191},
+			{69, 161, "Tm", 160, 933549.000},
+			{70, 161, "Yb", 160, 937906.846},
+			{71, 161, "Lu", 160, 943572.000},
+			{72, 161, "Hf", 160, 950279.151},
+			{73, 161, "Ta", 160, 958369.031},
+			{75, 161, "Re", 160, 977627.121},
+			{63, 162, "Eu", 161, 936979.303},
+			{64, 162, "Gd", 161, 930992.146},
+			{65, 162, "Tb", 161, 929493.955},
+			{66, 162, "Dy", 161, 926804.168},
+			{67, 162, "Ho", 161, 929101.485},
+			{68, 162, "Er", 161, 928786.960},
+			{69, 162, "Tm", 161, 934000.872},
+			{70, 162, "Yb", 161, 935773.771},
+			{71, 162, "Lu", 161, 943282.776},
+			{72, 162, "Hf", 161, 947214.896},
+			{73, 162, "Ta", 161, 957294.202},
+			{74, 162, "W", 161, 963500.347},
+			{63, 163, "Eu", 162, 939360.977},
+			{64, 163, "Gd", 162, 934176.832},
+			{65, 163, "Tb", 162, 930653.261},
+			{66, 163, "Dy", 162, 928736.879},
+			{67, 163, "Ho", 162, 928739.921},
+			{68, 163, "Er", 162, 930039.567},
+			{69, 163, "Tm", 162, 932657.941},
+			{70, 163, "Yb", 162, 936339.800},
+			{71, 163, "Lu", 162, 941179.000},
+			{72, 163, "Hf", 162, 947113.258},
+			{73, 163, "Ta", 162, 954337.195},
+			{74, 163, "W", 162, 962524.511},
+			{75, 163, "Re", 162, 972085.441},
+			{65, 164, "Tb", 163, 933356.559},
+			{66, 164, "Dy", 163, 929180.472},
+			{67, 164, "Ho", 163, 930239.483},
+			{68, 164, "Er", 163, 929207.392},
+			{69, 164, "Tm", 163, 933543.281},
+			{70, 164, "Yb", 163, 934495.103},
+			{71, 164, "Lu", 163, 941339.000},
+			{72, 164, "Hf", 163, 944370.544},
+			{73, 164, "Ta", 163, 953534.000},
+			{74, 164, "W", 163, 958952.222},
+			{75, 164, "Re", 163, 970507.124},
+			{76, 164, "Os", 163, 978075.966},
+			{66, 165, "Dy", 164, 931709.054},
+			{67, 165, "Ho", 164, 930328.047},
+			{68, 165, "Er", 164, 930733.198},
+			{69, 165, "Tm", 164, 932442.269},
+			{70, 165, "Yb", 164, 935270.241},
+			{71, 165, "Lu", 164, 939406.758},
+			{72, 165, "Hf", 164, 944567.000},
+			{73, 165, "Ta", 164, 950780.303},
+			{74, 165, "W", 164, 958280.974},
+			{75, 165, "Re", 164, 967085.375},
+			{65, 166, "Tb", 165, 937858.119},
+			{66, 166, "Dy", 165, 932812.461},
+			{67, 166, "Ho", 165, 932290.139},
+			{68, 166, "Er", 165, 930299.023},
+			{69, 166, "Tm", 165, 933560.092},
+			{70, 166, "Yb", 165, 933874.249},
+			{71, 166, "Lu", 165, 939859.000},
+			{72, 166, "Hf", 165, 942180.000},
+			{73, 166, "Ta", 165, 950512.000},
+			{74, 166, "W", 165, 955031.346},
+			{75, 166, "Re", 165, 965760.940},
+			{76, 166, "Os", 165, 972698.141},
+			{66, 167, "Dy", 166, 935661.823},
+			{67, 167, "Ho", 166, 933138.994},
+			{68, 167, "Er", 166, 932054.119},
+			{69, 167, "Tm", 166, 932856.635},
+			{70, 167, "Yb", 166, 934953.337},
+			{71, 167, "Lu", 166, 938270.000},
+			{72, 167, "Hf", 166, 942600.000},
+			{73, 167, "Ta", 166, 948093.000},
+			{74, 167, "W", 166, 954805.873},
+			{76, 167, "Os", 166, 971548.938},
+			{77, 167, "Ir", 166, 981671.981},
+			{66, 168, "Dy", 167, 937133.716},
+			{67, 168, "Ho", 167, 935521.676},
+			{68, 168, "Er", 167, 932376.192},
+			{69, 168, "Tm", 167, 934177.868},
+			{70, 168, "Yb", 167, 933889.106},
+			{71, 168, "Lu", 167, 938735.139},
+			{72, 168, "Hf", 167, 940568.000},
+			{73, 168, "Ta", 167, 948047.000},
+			{74, 168, "W", 167, 951805.262},
+			{75, 168, "Re", 167, 961572.608},
+			{76, 168, "Os", 167, 967798.812},
+			{77, 168, "Ir", 167, 979960.981},
+			{78, 168, "Pt", 167, 988183.004},
+			{66, 169, "Dy", 168, 940313.971},
+			{67, 169, "Ho", 168, 936878.630},
+			{68, 169, "Er", 168, 934596.353},
+			{69, 169, "Tm", 168, 934218.350},
+			{70, 169, "Yb", 168, 935182.016},
+			{71, 169, "Lu", 168, 937643.653},
+			{72, 169, "Hf", 168, 941259.000},
+			{73, 169, "Ta", 168, 946011.000},
+			{74, 169, "W", 168, 951778.677},
+			{75, 169, "Re", 168, 958765.991},
+			{76, 169, "Os", 168, 967017.833},
+			{77, 169, "Ir", 168, 976281.287},
+			{67, 170, "Ho", 169, 939625.289},
+			{68, 170, "Er", 169, 935470.673},
+			{69, 170, "Tm", 169, 935806.507},
+			{70, 170, "Yb", 169, 934767.245},
+			{71, 170, "Lu", 169, 938479.234},
+			{72, 170, "Hf", 169, 939609.000},
+			{73, 170, "Ta", 169, 946175.000},
+			{74, 170, "W", 169, 949231.200},
+			{75, 170, "Re", 169, 958224.966},
+			{76, 170, "Os", 169, 963578.673},
+			{78, 170, "Pt", 169, 982502.095},
+			{67, 171, "Ho", 170, 941471.490},
+			{68, 171, "Er", 170, 938036.148},
+			{69, 171, "Tm", 170, 936435.126},
+			{70, 171, "Yb", 170, 936331.517},
+			{71, 171, "Lu", 170, 937918.660},
+			{72, 171, "Hf", 170, 940492.000},
+			{73, 171, "Ta", 170, 944476.000},
+			{74, 171, "W", 170, 949451.000},
+			{75, 171, "Re", 170, 955716.000},
+			{76, 171, "Os", 170, 963175.348},
+			{77, 171, "Ir", 170, 971645.522},
+			{78, 171, "Pt", 170, 981245.502},
+			{79, 171, "Au", 170, 991881.542},
+			{68, 172, "Er", 171, 939362.344},
+			{69, 172, "Tm", 171, 938406.067},
+			{70, 172, "Yb", 171, 936386.658},
+			{71, 172, "Lu", 171, 939091.417},
+			{72, 172, "Hf", 171, 939449.716},
+			{73, 172, "Ta", 171, 944895.000},
+			{74, 172, "W", 171, 947292.000},
+			{75, 172, "Re", 171, 955408.079},
+			{76, 172, "Os", 171, 960017.088},
+			{77, 172, "Ir", 171, 970607.036},
+			{78, 172, "Pt", 171, 977340.788},
+			{79, 172, "Au", 171, 989996.708},
+			{80, 172, "Hg", 171, 998863.391},
+			{69, 173, "Tm", 172, 939606.632},
+			{70, 173, "Yb", 172, 938216.215},
+			{71, 173, "Lu", 172, 938935.822},
+			{72, 173, "Hf", 172, 940513.000},
+			{73, 173, "Ta", 172, 943750.000},
+			{74, 173, "W", 172, 947689.000},
+			{75, 173, "Re", 172, 953243.000},
+			{76, 173, "Os", 172, 959808.375},
+			{77, 173, "Ir", 172, 967505.496},
+			{78, 173, "Pt", 172, 976443.315},
+			{79, 173, "Au", 172, 986223.808},
+			{69, 174, "Tm", 173, 942174.064},
+			{70, 174, "Yb", 173, 938867.548},
+			{71, 174, "Lu", 173, 940342.938},
+			{72, 174, "Hf", 173, 940048.480},
+			{73, 174, "Ta", 173, 944454.000},
+			{74, 174, "W", 173, 946079.000},
+			{75, 174, "Re", 173, 953115.000},
+			{76, 174, "Os", 173, 957063.152},
+			{77, 174, "Ir", 173, 966866.676},
+			{78, 174, "Pt", 173, 972819.832},
+			{80, 174, "Hg", 173, 992870.583},
+			{69, 175, "Tm", 174, 943842.313},
+			{70, 175, "Yb", 174, 941281.910},
+			{71, 175, "Lu", 174, 940777.308},
+			{72, 175, "Hf", 174, 941511.527},
+			{73, 175, "Ta", 174, 943737.000},
+			{74, 175, "W", 174, 946717.000},
+			{75, 175, "Re", 174, 951381.000},
+			{76, 175, "Os", 174, 956945.105},
+			{77, 175, "Ir", 174, 964149.521},
+			{78, 175, "Pt", 174, 972395.457},
+			{79, 175, "Au", 174, 981316.085},
+			{80, 175, "Hg", 174, 991441.086},
+			{69, 176, "Tm", 175, 946997.711},
+			{70, 176, "Yb", 175, 942574.708},
+			{71, 176, "Lu", 175, 942691.809},
+			{72, 176, "Hf", 175, 941409.905},
+			{73, 176, "Ta", 175, 944857.000},
+			{74, 176, "W", 175, 945634.000},
+			{75, 176, "Re", 175, 951623.000},
+			{76, 176, "Os", 175, 954806.000},
+			{77, 176, "Ir", 175, 963630.119},
+			{78, 176, "Pt", 175, 968938.214},
+			{79, 176, "Au", 175, 980116.927},
+			{80, 176, "Hg", 175, 987348.335},
+			{81, 176, "Tl", 176, 624.367},
+			{70, 177, "Yb", 176, 945263.848},
+			{71, 177, "Lu", 176, 943763.668},
+			{72, 177, "Hf", 176, 943230.320},
+			{73, 177, "Ta", 176, 944482.073},
+			{74, 177, "W", 176, 946643.000},
+			{75, 177, "Re", 176, 950328.000},
+			{76, 177, "Os", 176, 954957.882},
+			{77, 177, "Ir", 176, 961301.500},
+			{78, 177, "Pt", 176, 968469.529},
+			{79, 177, "Au", 176, 976870.379},
+			{80, 177, "Hg", 176, 986277.376},
+			{81, 177, "Tl", 176, 996413.797},
+			{70, 178, "Yb", 177, 946649.710},
+			{71, 178, "Lu", 177, 945960.162},
+			{72, 178, "Hf", 177, 943708.456},
+			{74, 178, "W", 177, 945885.925},
+			{75, 178, "Re", 177, 950989.000},
+			{76, 178, "Os", 177, 953253.300},
+			{77, 178, "Ir", 177, 961082.000},
+			{78, 178, "Pt", 177, 965649.248},
+			{79, 178, "Au", 177, 976055.945},
+			{80, 178, "Hg", 177, 982484.158},
+			{82, 178, "Pb", 178, 3837.163},
+			{71, 179, "Lu", 178, 947333.082},
+			{72, 179, "Hf", 178, 945825.838},
+			{73, 179, "Ta", 178, 945939.187},
+			{74, 179, "W", 178, 947079.501},
+			{75, 179, "Re", 178, 949989.715},
+			{76, 179, "Os", 178, 953816.669},
+			{77, 179, "Ir", 178, 959117.596},
+			{78, 179, "Pt", 178, 965358.719},
+			{79, 179, "Au", 178, 973173.668},
+			{80, 179, "Hg", 178, 981826.899},
+			{81, 179, "Tl", 178, 991123.405},
+			{82, 179, "Pb", 179, 2201.452},
+			{71, 180, "Lu", 179, 949890.876},
+			{72, 180, "Hf", 179, 946559.669},
+			{73, 180, "Ta", 179, 947468.392},
+			{74, 180, "W", 179, 946713.435},
+			{75, 180, "Re", 179, 950791.568},
+			{76, 180, "Os", 179, 952379.930},
+			{77, 180, "Ir", 179, 959229.446},
+			{78, 180, "Pt", 179, 963031.563},
+			{79, 180, "Au", 179, 972489.883},
+			{80, 180, "Hg", 179, 978260.249},
+			{81, 180, "Tl", 179, 989923.019},
+			{82, 180, "Pb", 179, 997915.842},
+			{71, 181, "Lu", 180, 951908.000},
+			{72, 181, "Hf", 180, 949110.965},
+			{73, 181, "Ta", 180, 947999.331},
+			{74, 181, "W", 180, 948218.863},
+			{75, 181, "Re", 180, 950061.523},
+			{76, 181, "Os", 180, 953247.188},
+			{77, 181, "Ir", 180, 957634.694},
+			{78, 181, "Pt", 180, 963089.927},
+			{79, 181, "Au", 180, 970079.103},
+			{80, 181, "Hg", 180, 977819.357},
+			{81, 181, "Tl", 180, 986259.992},
+			{82, 181, "Pb", 180, 996653.386},
+			{72, 182, "Hf", 181, 950563.816},
+			{73, 182, "Ta", 181, 950155.413},
+			{74, 182, "W", 181, 948205.721},
+			{75, 182, "Re", 181, 951211.645},
+			{76, 182, "Os", 181, 952110.153},
+			{77, 182, "Ir", 181, 958076.296},
+			{78, 182, "Pt", 181, 961171.571},
+			{79, 182, "Au", 181, 969617.874},
+			{80, 182, "Hg", 181, 974689.132},
+			{81, 182, "Tl", 181, 985691.880},
+			{82, 182, "Pb", 181, 992672.940},
+			{71, 183, "Lu", 182, 957363.000},
+			{72, 183, "Hf", 182, 953534.004},
+			{73, 183, "Ta", 182, 951376.180},
+			{74, 183, "W", 182, 950224.500},
+			{75, 183, "Re", 182, 950821.390},
+			{76, 183, "Os", 182, 953124.719},
+			{77, 183, "Ir", 182, 956839.968},
+			{78, 183, "Pt", 182, 961596.653},
+			{79, 183, "Au", 182, 967588.108},
+			{80, 183, "Hg", 182, 974444.629},
+			{81, 183, "Tl", 182, 982192.846},
+			{82, 183, "Pb", 182, 991867.668},
+			{72, 184, "Hf", 183, 955448.587},
+			{73, 184, "Ta", 183, 954010.038},
+			{74, 184, "W", 183, 950933.260},
+			{75, 184, "Re", 183, 952528.267},
+			{76, 184, "Os", 183, 952492.949},
+			{77, 184, "Ir", 183, 957476.000},
+			{78, 184, "Pt", 183, 959920.039},
+			{79, 184, "Au", 183, 967451.524},
+			{80, 184, "Hg", 183, 971713.221},
+			{81, 184, "Tl", 183, 981875.093},
+			{82, 184, "Pb", 183, 988135.702},
+			{83, 184, "Bi", 184, 1141.250},
+			{72, 185, "Hf", 184, 958862.000},
+			{73, 185, "Ta", 184, 955561.396},
+			{74, 185, "W", 184, 953421.286},
+			{75, 185, "Re", 184, 952958.337},
+			{76, 185, "Os", 184, 954045.995},
+			{77, 185, "Ir", 184, 956698.000},
+			{78, 185, "Pt", 184, 960613.659},
+			{79, 185, "Au", 184, 965798.874},
+			{80, 185, "Hg", 184, 971890.676},
+			{81, 185, "Tl", 184, 978789.191},
+			{82, 185, "Pb", 184, 987609.989},
+			{72, 186, "Hf", 185, 960897.000},
+			{73, 186, "Ta", 185, 958553.111},
+			{74, 186, "W", 185, 954365.215},
+			{75, 186, "Re", 185, 954989.419},
+			{76, 186, "Os", 185, 953837.660},
+			{77, 186, "Ir", 185, 957946.754},
+			{78, 186, "Pt", 185, 959350.846},
+			{79, 186, "Au", 185, 965952.703},
+			{80, 186, "Hg", 185, 969362.017},
+			{81, 186, "Tl", 185, 978650.841},
+			{82, 186, "Pb", 185, 984238.196},
+			{83, 186, "Bi", 185, 996622.402},
+			{84, 186, "Po", 186, 4402.577},
+			{73, 187, "Ta", 186, 960391.000},
+			{74, 187, "W", 186, 957161.323},
+			{75, 187, "Re", 186, 955752.288},
+			{76, 187, "Os", 186, 955749.640},
+			{77, 187, "Ir", 186, 957542.000},
+			{78, 187, "Pt", 186, 960616.976},
+			{79, 187, "Au", 186, 964543.155},
+			{80, 187, "Hg", 186, 969814.158},
+			{81, 187, "Tl", 186, 975904.743},
+			{82, 187, "Pb", 186, 983910.836},
+			{83, 187, "Bi", 186, 993147.276},
+			{84, 187, "Po", 187, 3036.624},
+			{73, 188, "Ta", 187, 963916.000},
+			{74, 188, "W", 187, 958488.395},
+			{75, 188, "Re", 187, 958113.728},
+			{76, 188, "Os", 187, 955837.361},
+			{77, 188, "Ir", 187, 958835.046},
+			{78, 188, "Pt", 187, 959397.560},
+			{79, 188, "Au", 187, 965247.969},
+			{80, 188, "Hg", 187, 967576.910},
+			{81, 188, "Tl", 187, 976020.886},
+			{82, 188, "Pb", 187, 980874.592},
+			{83, 188, "Bi", 187, 992276.184},
+			{84, 188, "Po", 187, 999415.655},
+			{74, 189, "W", 188, 961763.000},
+			{75, 189, "Re", 188, 959227.817},
+			{76, 189, "Os", 188, 958146.005},
+			{77, 189, "Ir", 188, 958722.669},
+			{78, 189, "Pt", 188, 960848.542},
+			{79, 189, "Au", 188, 963948.286},
+			{80, 189, "Hg", 188, 968194.748},
+			{81, 189, "Tl", 188, 973573.527},
+			{82, 189, "Pb", 188, 980843.639},
+			{83, 189, "Bi", 188, 989195.141},
+			{84, 189, "Po", 188, 998473.415},
+			{74, 190, "W", 189, 963089.066},
+			{75, 190, "Re", 189, 961743.360},
+			{76, 190, "Os", 189, 958445.496},
+			{77, 190, "Ir", 189, 960543.445},
+			{78, 190, "Pt", 189, 959949.876},
+			{79, 190, "Au", 189, 964751.750},
+			{80, 190, "Hg", 189, 966322.169},
+			{81, 190, "Tl", 189, 973835.551},
+			{82, 190, "Pb", 189, 978081.828},
+			{83, 190, "Bi", 189, 988620.883},
+			{84, 190, "Po", 189, 995100.519},
+			{74, 191, "W", 190, 966531.000},
+			{75, 191, "Re", 190, 963123.437},
+			{76, 191, "Os", 190, 960928.159},
+			{77, 191, "Ir", 190, 960591.527},
+			{78, 191, "Pt", 190, 961676.363},
+			{79, 191, "Au", 190, 963716.455},
+			{80, 191, "Hg", 190, 967158.247},
+			{81, 191, "Tl", 190, 971784.096},
+			{82, 191, "Pb", 190, 978281.000},
+			{83, 191, "Bi", 190, 985786.975},
+			{84, 191, "Po", 190, 994558.488},
+			{85, 191, "At", 191, 4148.086},
+			{75, 192, "Re", 191, 966088.000},
+			{76, 192, "Os", 191, 961478.881},
+			{77, 192, "Ir", 191, 962602.485},
+			{78, 192, "Pt", 191, 961042.736},
+			{79, 192, "Au", 191, 964817.684},
+			{80, 192, "Hg", 191, 965634.182},
+			{81, 192, "Tl", 191, 972225.000},
+			{82, 192, "Pb", 191, 975785.115},
+			{83, 192, "Bi", 191, 985470.078},
+			{84, 192, "Po", 191, 991335.788},
+			{85, 192, "At", 192, 3141.034},
+			{75, 193, "Re", 192, 967545.000},
+			{76, 193, "Os", 192, 964149.753},
+			{77, 193, "Ir", 192, 962923.824},
+			{78, 193, "Pt", 192, 962984.616},
+			{79, 193, "Au", 192, 964138.447},
+			{80, 193, "Hg", 192, 966653.377},
+			{81, 193, "Tl", 192, 970501.997},
+			{82, 193, "Pb", 192, 976173.234},
+			{83, 193, "Bi", 192, 982947.223},
+			{84, 193, "Po", 192, 991062.403},
+			{85, 193, "At", 192, 999927.728},
+			{86, 193, "Rn", 193, 9707.964},
+			{76, 194, "Os", 193, 965179.477},
+			{77, 194, "Ir", 193, 965075.773},
+			{78, 194, "Pt", 193, 962683.527},
+			{79, 194, "Au", 193, 965419.062},
+			{80, 194, "Hg", 193, 965449.111},
+			{81, 194, "Tl", 193, 971081.411},
+			{82, 194, "Pb", 193, 974011.706},
+			{83, 194, "Bi", 193, 982792.362},
+			{84, 194, "Po", 193, 988186.015},
+			{85, 194, "At", 193, 999226.872},
+			{86, 194, "Rn", 194, 6144.424},
+			{76, 195, "Os", 194, 968318.000},
+			{77, 195, "Ir", 194, 965976.967},
+			{78, 195, "Pt", 194, 964794.353},
+			{79, 195, "Au", 194, 965037.851},
+			{80, 195, "Hg", 194, 966705.751},
+			{81, 195, "Tl", 194, 969774.096},
+			{82, 195, "Pb", 194, 974548.743},
+			{83, 195, "Bi", 194, 980648.762},
+			{84, 195, "Po", 194, 988130.617},
+			{85, 195, "At", 194, 996274.485},
+			{86, 195, "Rn", 195, 5421.699},
+			{76, 196, "Os", 195, 969643.277},
+			{77, 196, "Ir", 195, 968399.696},
+			{78, 196, "Pt", 195, 964954.675},
+			{79, 196, "Au", 195, 966571.221},
+			{80, 196, "Hg", 195, 965833.444},
+			{81, 196, "Tl", 195, 970481.192},
+			{82, 196, "Pb", 195, 972787.466},
+			{83, 196, "Bi", 195, 980666.509},
+			{84, 196, "Po", 195, 985536.094},
+			{85, 196, "At", 195, 995797.421},
+			{86, 196, "Rn", 196, 2115.945},
+			{77, 197, "Ir", 196, 969657.233},
+			{78, 197, "Pt", 196, 967343.053},
+			{79, 197, "Au", 196, 966570.114},
+			{80, 197, "Hg", 196, 967213.713},
+			{81, 197, "Tl", 196, 969573.986},
+			{82, 197, "Pb", 196, 973434.717},
+			{83, 197, "Bi", 196, 978864.929},
+			{84, 197, "Po", 196, 985659.607},
+			{85, 197, "At", 196, 993177.357},
+			{86, 197, "Rn", 197, 1621.430},
+			{87, 197, "Fr", 197, 11008.090},
+			{78, 198, "Pt", 197, 967896.734},
+			{79, 198, "Au", 197, 968243.724},
+			{80, 198, "Hg", 197, 966769.179},
+			{81, 198, "Tl", 197, 970446.673},
+			{82, 198, "Pb", 197, 972015.397},
+			{83, 198, "Bi", 197, 979206.000},
+			{84, 198, "Po", 197, 983388.672},
+			{85, 198, "At", 197, 992791.673},
+			{86, 198, "Rn", 197, 998679.156},
+			{87, 198, "Fr", 198, 10278.138},
+			{77, 199, "Ir", 198, 973807.115},
+			{78, 199, "Pt", 198, 970597.038},
+			{79, 199, "Au", 198, 968766.582},
+			{80, 199, "Hg", 198, 968280.989},
+			{81, 199, "Tl", 198, 969877.000},
+			{82, 199, "Pb", 198, 972912.542},
+			{83, 199, "Bi", 198, 977672.893},
+			{84, 199, "Po", 198, 983673.021},
+			{85, 199, "At", 198, 990527.719},
+			{86, 199, "Rn", 198, 998390.273},
+			{87, 199, "Fr", 199, 7269.389},
+			{78, 200, "Pt", 199, 971444.625},
+			{79, 200, "Au", 199, 970756.556},
+			{80, 200, "Hg", 199, 968326.934},
+			{81, 200, "Tl", 199, 970963.602},
+			{82, 200, "Pb", 199, 971818.332},
+			{83, 200, "Bi", 199, 978131.093},
+			{84, 200, "Po", 199, 981812.270},
+			{85, 200, "At", 199, 990351.100},
+			{86, 200, "Rn", 199, 995700.707},
+			{87, 200, "Fr", 200, 6583.507},
+			{78, 201, "Pt", 200, 974513.293},
+			{79, 201, "Au", 200, 971657.665},
+			{80, 201, "Hg", 200, 970303.038},
+			{81, 201, "Tl", 200, 970820.168},
+			{82, 201, "Pb", 200, 972870.425},
+			{83, 201, "Bi", 200, 977008.512},
+			{84, 201, "Po", 200, 982263.777},
+			{85, 201, "At", 200, 988417.061},
+			{86, 201, "Rn", 200, 995628.179},
+			{87, 201, "Fr", 201, 3852.496},
+			{88, 201, "Ra", 201, 12814.683},
+			{78, 202, "Pt", 201, 975639.000},
+			{79, 202, "Au", 201, 973856.000},
+			{80, 202, "Hg", 201, 970643.585},
+			{81, 202, "Tl", 201, 972109.089},
+			{82, 202, "Pb", 201, 972151.604},
+			{83, 202, "Bi", 201, 977733.100},
+			{84, 202, "Po", 201, 980738.881},
+			{85, 202, "At", 201, 988630.380},
+			{86, 202, "Rn", 201, 993263.902},
+			{87, 202, "Fr", 202, 3323.946},
+			{88, 202, "Ra", 202, 9742.264},
+			{79, 203, "Au", 202, 975154.498},
+			{80, 203, "Hg", 202, 972872.326},
+			{81, 203, "Tl", 202, 972344.022},
+			{82, 203, "Pb", 202, 973390.535},
+			{83, 203, "Bi", 202, 976892.145},
+			{84, 203, "Po", 202, 981415.995},
+			{85, 203, "At", 202, 986942.957},
+			{86, 203, "Rn", 202, 993393.732},
+			{87, 203, "Fr", 203, 940.872},
+			{88, 203, "Ra", 203, 9298.745},
+			{80, 204, "Hg", 203, 973494.037},
+			{81, 204, "Tl", 203, 973863.337},
+			{82, 204, "Pb", 203, 973043.420},
+			{83, 204, "Bi", 203, 977835.717},
+			{84, 204, "Po", 203, 980309.863},
+			{85, 204, "At", 203, 987251.197},
+			{86, 204, "Rn", 203, 991443.644},
+			{87, 204, "Fr", 204, 651.974},
+			{88, 204, "Ra", 204, 6502.228},
+			{80, 205, "Hg", 204, 976073.125},
+			{81, 205, "Tl", 204, 974427.237},
+			{82, 205, "Pb", 204, 974481.597},
+			{83, 205, "Bi", 204, 977386.323},
+			{84, 205, "Po", 204, 981190.004},
+			{85, 205, "At", 204, 986074.041},
+			{86, 205, "Rn", 204, 991723.204},
+			{87, 205, "Fr", 204, 998593.858},
+			{88, 205, "Ra", 205, 6268.415},
+			{89, 205, "Ac", 205, 15144.158},
+			{80, 206, "Hg", 205, 977513.756},
+			{81, 206, "Tl", 205, 976110.026},
+			{82, 206, "Pb", 205, 974465.124},
+			{83, 206, "Bi", 205, 978498.757},
+			{84, 206, "Po", 205, 980473.654},
+			{85, 206, "At", 205, 986656.148},
+			{86, 206, "Rn", 205, 990195.358},
+			{87, 206, "Fr", 205, 998666.211},
+			{88, 206, "Ra", 206, 3827.763},
+			{89, 206, "Ac", 206, 14470.787},
+			{80, 207, "Hg", 206, 982300.000},
+			{81, 207, "Tl", 206, 977418.586},
+			{82, 207, "Pb", 206, 975896.735},
+			{83, 207, "Bi", 206, 978470.471},
+			{84, 207, "Po", 206, 981593.252},
+			{85, 207, "At", 206, 985799.783},
+			{86, 207, "Rn", 206, 990730.200},
+			{87, 207, "Fr", 206, 996946.474},
+			{88, 207, "Ra", 207, 3805.161},
+			{89, 207, "Ac", 207, 11965.973},
+			{80, 208, "Hg", 207, 985759.000},
+			{81, 208, "Tl", 207, 982017.992},
+			{82, 208, "Pb", 207, 976651.918},
+			{83, 208, "Bi", 207, 979741.981},
+			{84, 208, "Po", 207, 981245.616},
+			{85, 208, "At", 207, 986613.042},
+			{86, 208, "Rn", 207, 989634.295},
+			{87, 208, "Fr", 207, 997138.018},
+			{88, 208, "Ra", 208, 1854.929},
+			{89, 208, "Ac", 208, 11544.073},
+			{90, 208, "Th", 208, 17910.722},
+			{81, 209, "Tl", 208, 985351.750},
+			{82, 209, "Pb", 208, 981089.898},
+			{83, 209, "Bi", 208, 980398.519},
+			{84, 209, "Po", 208, 982430.276},
+			{85, 209, "At", 208, 986169.944},
+			{86, 209, "Rn", 208, 990401.388},
+			{87, 209, "Fr", 208, 995953.197},
+			{88, 209, "Ra", 209, 1994.879},
+			{89, 209, "Ac", 209, 9494.220},
+			{81, 210, "Tl", 209, 990072.970},
+			{82, 210, "Pb", 209, 984188.301},
+			{83, 210, "Bi", 209, 984120.156},
+			{84, 210, "Po", 209, 982873.601},
+			{85, 210, "At", 209, 987147.338},
+			{86, 210, "Rn", 209, 989688.854},
+			{87, 210, "Fr", 209, 996421.657},
+			{88, 210, "Ra", 210, 475.356},
+			{89, 210, "Ac", 210, 9436.130},
+			{90, 210, "Th", 210, 15093.437},
+			{81, 211, "Tl", 210, 993475.000},
+			{82, 211, "Pb", 210, 988735.356},
+			{83, 211, "Bi", 210, 987268.698},
+			{84, 211, "Po", 210, 986653.085},
+			{85, 211, "At", 210, 987496.147},
+			{86, 211, "Rn", 210, 990600.686},
+			{87, 211, "Fr", 210, 995555.259},
+			{88, 211, "Ra", 211, 893.213},
+			{89, 211, "Ac", 211, 7731.894},
+			{90, 211, "Th", 211, 14933.183},
+			{82, 212, "Pb", 211, 991895.975},
+			{83, 212, "Bi", 211, 991285.016},
+			{84, 212, "Po", 211, 988867.896},
+			{85, 212, "At", 211, 990737.223},
+			{86, 212, "Rn", 211, 990703.528},
+			{87, 212, "Fr", 211, 996225.453},
+			{88, 212, "Ra", 211, 999786.399},
+			{89, 212, "Ac", 212, 7812.501},
+			{90, 212, "Th", 212, 13001.487},
+			{91, 212, "Pa", 212, 23181.425},
+			{81, 213, "Tl", 213, 1915.000},
+			{82, 213, "Pb", 212, 996560.867},
+			{83, 213, "Bi", 212, 994383.608},
+			{84, 213, "Po", 212, 992857.083},
+			{85, 213, "At", 212, 992936.514},
+			{86, 213, "Rn", 212, 993885.064},
+			{87, 213, "Fr", 212, 996185.861},
+			{88, 213, "Ra", 213, 370.970},
+			{89, 213, "Ac", 213, 6607.333},
+			{90, 213, "Th", 213, 13011.447},
+			{91, 213, "Pa", 213, 21108.697},
+			{82, 214, "Pb", 213, 999803.788},
+			{83, 214, "Bi", 213, 998710.938},
+			{84, 214, "Po", 213, 995201.208},
+			{85, 214, "At", 213, 996371.601},
+			{86, 214, "Rn", 213, 995362.566},
+			{87, 214, "Fr", 213, 998970.785},
+			{88, 214, "Ra", 214, 99.554},
+			{89, 214, "Ac", 214, 6917.762},
+			{90, 214, "Th", 214, 11481.431},
+			{91, 214, "Pa", 214, 20918.561},
+			{82, 215, "Pb", 215, 4661.590},
+			{83, 215, "Bi", 215, 1749.149},
+			{84, 215, "Po", 214, 999418.454},
+			{85, 215, "At", 214, 998651.890},
+			{86, 215, "Rn", 214, 998745.498},
+			{87, 215, "Fr", 215, 341.456},
+			{88, 215, "Ra", 215, 2720.080},
+			{89, 215, "Ac", 215, 6474.132},
+			{90, 215, "Th", 215, 11724.805},
+			{91, 215, "Pa", 215, 19177.728},
+			{92, 215, "U", 215, 26756.035},
+			{83, 216, "Bi", 216, 6305.989},
+			{84, 216, "Po", 216, 1913.506},
+			{85, 216, "At", 216, 2422.631},
+			{86, 216, "Rn", 216, 271.464},
+			{87, 216, "Fr", 216, 3189.445},
+			{88, 216, "Ra", 216, 3533.117},
+			{89, 216, "Ac", 216, 8743.367},
+			{90, 216, "Th", 216, 11055.714},
+			{91, 216, "Pa", 216, 19108.242},
+			{92, 216, "U", 216, 24762.747},
+			{83, 217, "Bi", 217, 9372.000},
+			{84, 217, "Po", 217, 6316.216},
+			{85, 217, "At", 217, 4717.835},
+			{86, 217, "Rn", 217, 3927.562},
+			{87, 217, "Fr", 217, 4631.902},
+			{88, 217, "Ra", 217, 6322.806},
+			{89, 217, "Ac", 217, 9343.777},
+			{90, 217, "Th", 217, 13103.444},
+			{91, 217, "Pa", 217, 18323.692},
+			{83, 218, "Bi", 218, 14188.000},
+			{84, 218, "Po", 218, 8971.502},
+			{85, 218, "At", 218, 8693.735},
+			{86, 218, "Rn", 218, 5601.052},
+			{87, 218, "Fr", 218, 7578.274},
+			{88, 218, "Ra", 218, 7140.325},
+			{89, 218, "Ac", 218, 11641.093},
+			{90, 218, "Th", 218, 13276.242},
+			{91, 218, "Pa", 218, 20057.853},
+			{92, 218, "U", 218, 23504.829},
+			{84, 219, "Po", 219, 13614.000},
+			{85, 219, "At", 219, 11160.647},
+			{86, 219, "Rn", 219, 9478.753},
+			{87, 219, "Fr", 219, 9251.553},
+			{88, 219, "Ra", 219, 10085.176},
+			{89, 219, "Ac", 219, 12420.348},
+			{90, 219, "Th", 219, 15535.677},
+			{91, 219, "Pa", 219, 19903.650},
+			{92, 219, "U", 219, 24999.161},
+			{93, 219, "Np", 219, 31623.021},
+			{84, 220, "Po", 220, 16386.000},
+			{85, 220, "At", 220, 15433.000},
+			{86, 220, "Rn", 220, 11392.534},
+			{87, 220, "Fr", 220, 12326.778},
+			{88, 220, "Ra", 220, 11025.562},
+			{89, 220, "Ac", 220, 14754.450},
+			{90, 220, "Th", 220, 15747.926},
+			{84, 221, "Po", 221, 21228.000},
+			{85, 221, "At", 221, 18017.000},
+			{86, 221, "Rn", 221, 15535.709},
+			{87, 221, "Fr", 221, 14253.757},
+			{88, 221, "Ra", 221, 13917.224},
+			{89, 221, "Ac", 221, 15591.199},
+			{90, 221, "Th", 221, 18186.236},
+			{91, 221, "Pa", 221, 21874.846},
+			{92, 221, "U", 221, 26323.299},
+			{84, 222, "Po", 222, 24140.000},
+			{85, 222, "At", 222, 22494.000},
+			{86, 222, "Rn", 222, 17576.286},
+			{87, 222, "Fr", 222, 17582.620},
+			{88, 222, "Ra", 222, 15373.355},
+			{89, 222, "Ac", 222, 17843.887},
+			{90, 222, "Th", 222, 18468.300},
+			{92, 222, "U", 222, 26057.953},
+			{85, 223, "At", 223, 25151.000},
+			{86, 223, "Rn", 223, 21889.285},
+			{87, 223, "Fr", 223, 19734.313},
+			{88, 223, "Ra", 223, 18500.719},
+			{89, 223, "Ac", 223, 19136.872},
+			{90, 223, "Th", 223, 20811.546},
+			{91, 223, "Pa", 223, 23962.232},
+			{92, 223, "U", 223, 27737.168},
+			{85, 224, "At", 224, 29749.000},
+			{86, 224, "Rn", 224, 24095.804},
+			{87, 224, "Fr", 224, 23348.100},
+			{88, 224, "Ra", 224, 20210.453},
+			{89, 224, "Ac", 224, 21722.239},
+			{90, 224, "Th", 224, 21464.157},
+			{91, 224, "Pa", 224, 25617.210},
+			{92, 224, "U", 224, 27613.974},
+			{86, 225, "Rn", 225, 28485.574},
+			{87, 225, "Fr", 225, 25572.478},
+			{88, 225, "Ra", 225, 23610.574},
+			{89, 225, "Ac", 225, 23228.647},
+			{90, 225, "Th", 225, 23950.907},
+			{91, 225, "Pa", 225, 26130.844},
+			{92, 225, "U", 225, 29393.555},
+			{93, 225, "Np", 225, 33910.797},
+			{86, 226, "Rn", 226, 30861.382},
+			{87, 226, "Fr", 226, 29544.515},
+			{88, 226, "Ra", 226, 25408.455},
+			{89, 226, "Ac", 226, 26097.069},
+			{90, 226, "Th", 226, 24903.686},
+			{91, 226, "Pa", 226, 27947.872},
+			{92, 226, "U", 226, 29338.749},
+			{86, 227, "Rn", 227, 35304.396},
+			{87, 227, "Fr", 227, 31865.417},
+			{88, 227, "Ra", 227, 29176.474},
+			{89, 227, "Ac", 227, 27750.666},
+			{90, 227, "Th", 227, 27702.618},
+			{91, 227, "Pa", 227, 28804.477},
+			{92, 227, "U", 227, 31181.587},
+			{93, 227, "Np", 227, 34956.832},
+			{86, 228, "Rn", 228, 37835.418},
+			{87, 228, "Fr", 228, 35839.437},
+			{88, 228, "Ra", 228, 31068.657},
+			{89, 228, "Ac", 228, 31019.767},
+			{90, 228, "Th", 228, 28739.835},
+			{91, 228, "Pa", 228, 31050.748},
+			{92, 228, "U", 228, 31371.351},
+			{93, 228, "Np", 228, 36066.462},
+			{94, 228, "Pu", 228, 38741.387},
+			{86, 229, "Rn", 229, 42257.276},
+			{87, 229, "Fr", 229, 38291.455},
+			{88, 229, "Ra", 229, 34956.707},
+			{89, 229, "Ac", 229, 32947.000},
+			{90, 229, "Th", 229, 31761.431},
+			{91, 229, "Pa", 229, 32095.652},
+			{92, 229, "U", 229, 33505.909},
+			{93, 229, "Np", 229, 36263.974},
+			{94, 229, "Pu", 229, 40145.819},
+			{95, 229, "Am", 229, 45249.909},
+			{87, 230, "Fr", 230, 42390.791},
+			{88, 230, "Ra", 230, 37054.780},
+			{89, 230, "Ac", 230, 36327.000},
+			{90, 230, "Th", 230, 33132.358},
+			{91, 230, "Pa", 230, 34539.789},
+			{92, 230, "U", 230, 33940.102},
+			{93, 230, "Np", 230, 37827.716},
+			{94, 230, "Pu", 230, 39650.703},
+			{87, 231, "Fr", 231, 45175.357},
+			{88, 231, "Ra", 231, 41027.086},
+			{89, 231, "Ac", 231, 38393.000},
+			{90, 231, "Th", 231, 36302.853},
+			{91, 231, "Pa", 231, 35882.575},
+			{92, 231, "U", 231, 36292.252},
+			{93, 231, "Np", 231, 38244.490},
+			{94, 231, "Pu", 231, 41126.410},
+			{87, 232, "Fr", 232, 49461.224},
+			{88, 232, "Ra", 232, 43475.270},
+			{89, 232, "Ac", 232, 42034.000},
+			{90, 232, "Th", 232, 38053.689},
+			{91, 232, "Pa", 232, 38590.300},
+			{92, 232, "U", 232, 37154.860},
+			{94, 232, "Pu", 232, 41184.526},
+			{87, 233, "Fr", 233, 52517.838},
+			{88, 233, "Ra", 233, 47594.573},
+			{89, 233, "Ac", 233, 44346.000},
+			{90, 233, "Th", 233, 41580.208},
+			{91, 233, "Pa", 233, 40246.605},
+			{92, 233, "U", 233, 39634.367},
+			{93, 233, "Np", 233, 40739.489},
+			{94, 233, "Pu", 233, 42997.345},
+			{96, 233, "Cm", 233, 50772.206},
+			{88, 234, "Ra", 234, 50382.104},
+			{89, 234, "Ac", 234, 48139.000},
+			{90, 234, "Th", 234, 43599.860},
+			{91, 234, "Pa", 234, 43305.615},
+			{92, 234, "U", 234, 40950.370},
+			{93, 234, "Np", 234, 42893.320},
+			{94, 234, "Pu", 234, 43317.478},
+			{96, 234, "Cm", 234, 50160.959},
+			{89, 235, "Ac", 235, 50840.000},
+			{90, 235, "Th", 235, 47255.000},
+			{91, 235, "Pa", 235, 45399.000},
+			{92, 235, "U", 235, 43928.190},
+			{93, 235, "Np", 235, 44061.591},
+			{94, 235, "Pu", 235, 45284.682},
+			{95, 235, "Am", 235, 47907.371},
+			{89, 236, "Ac", 236, 54988.000},
+			{90, 236, "Th", 236, 49657.000},
+			{91, 236, "Pa", 236, 48668.000},
+			{92, 236, "U", 236, 45566.201},
+			{93, 236, "Np", 236, 46568.392},
+			{94, 236, "Pu", 236, 46056.756},
+			{96, 236, "Cm", 236, 51374.506},
+			{90, 237, "Th", 237, 53629.000},
+			{91, 237, "Pa", 237, 51023.000},
+			{92, 237, "U", 237, 48728.380},
+			{93, 237, "Np", 237, 48171.710},
+			{94, 237, "Pu", 237, 48407.957},
+			{96, 237, "Cm", 237, 52868.923},
+			{98, 237, "Cf", 237, 62199.993},
+			{91, 238, "Pa", 238, 54637.000},
+			{92, 238, "U", 238, 50786.996},
+			{93, 238, "Np", 238, 50944.671},
+			{94, 238, "Pu", 238, 49558.250},
+			{95, 238, "Am", 238, 51982.607},
+			{96, 238, "Cm", 238, 53081.595},
+			{92, 239, "U", 239, 54292.048},
+			{93, 239, "Np", 239, 52937.599},
+			{94, 239, "Pu", 239, 52161.669},
+			{95, 239, "Am", 239, 53022.803},
+			{96, 239, "Cm", 239, 54908.593},
+			{92, 240, "U", 240, 56592.425},
+			{93, 240, "Np", 240, 56163.830},
+			{94, 240, "Pu", 240, 53811.812},
+			{95, 240, "Am", 240, 55298.444},
+			{96, 240, "Cm", 240, 55528.329},
+			{98, 240, "Cf", 240, 62255.842},
+			{93, 241, "Np", 241, 58250.697},
+			{94, 241, "Pu", 241, 56849.722},
+			{95, 241, "Am", 241, 56827.413},
+			{96, 241, "Cm", 241, 57651.288},
+			{93, 242, "Np", 242, 61639.615},
+			{94, 242, "Pu", 242, 58741.045},
+			{95, 242, "Am", 242, 59547.428},
+			{96, 242, "Cm", 242, 58834.263},
+			{98, 242, "Cf", 242, 63754.533},
+			{94, 243, "Pu", 243, 62002.119},
+			{95, 243, "Am", 243, 61379.940},
+			{96, 243, "Cm", 243, 61387.403},
+			{97, 243, "Bk", 243, 63005.980},
+			{94, 244, "Pu", 244, 64204.415},
+			{95, 244, "Am", 244, 64282.964},
+			{96, 244, "Cm", 244, 62750.694},
+			{97, 244, "Bk", 244, 65179.039},
+			{98, 244, "Cf", 244, 65999.543},
+			{94, 245, "Pu", 245, 67824.568},
+			{95, 245, "Am", 245, 66452.890},
+			{96, 245, "Cm", 245, 65491.113},
+			{97, 245, "Bk", 245, 66359.885},
+			{98, 245, "Cf", 245, 68046.825},
+			{94, 246, "Pu", 246, 70204.209},
+			{96, 246, "Cm", 246, 67222.082},
+			{97, 246, "Bk", 246, 68671.367},
+			{98, 246, "Cf", 246, 68803.762},
+			{100, 246, "Fm", 246, 75350.815},
+			{96, 247, "Cm", 247, 70352.726},
+			{97, 247, "Bk", 247, 70305.940},
+			{98, 247, "Cf", 247, 70965.462},
+			{99, 247, "Es", 247, 73621.932},
+			{96, 248, "Cm", 248, 72349.101},
+			{98, 248, "Cf", 248, 72182.978},
+			{100, 248, "Fm", 248, 77185.528},
+			{96, 249, "Cm", 249, 75954.006},
+			{97, 249, "Bk", 249, 74983.182},
+			{98, 249, "Cf", 249, 74850.491},
+			{100, 249, "Fm", 249, 78926.098},
+			{96, 250, "Cm", 250, 78357.556},
+			{97, 250, "Bk", 250, 78315.027},
+			{98, 250, "Cf", 250, 76404.561},
+			{100, 250, "Fm", 250, 79519.828},
+			{96, 251, "Cm", 251, 82285.036},
+			{97, 251, "Bk", 251, 80760.603},
+			{98, 251, "Cf", 251, 79587.219},
+			{99, 251, "Es", 251, 79992.224},
+			{100, 251, "Fm", 251, 81539.889},
+			{101, 251, "Md", 251, 84774.291},
+			{98, 252, "Cf", 252, 81626.523},
+			{99, 252, "Es", 252, 82979.189},
+			{100, 252, "Fm", 252, 82464.972},
+			{102, 252, "No", 252, 88966.141},
+			{98, 253, "Cf", 253, 85133.738},
+			{99, 253, "Es", 253, 84821.305},
+			{100, 253, "Fm", 253, 85181.160},
+			{102, 253, "No", 253, 90562.831},
+			{98, 254, "Cf", 254, 87323.590},
+			{99, 254, "Es", 254, 88020.527},
+			{100, 254, "Fm", 254, 86852.726},
+			{102, 254, "No", 254, 90954.259},
+			{99, 255, "Es", 255, 90273.553},
+			{100, 255, "Fm", 255, 89962.633},
+			{101, 255, "Md", 255, 91082.787},
+			{102, 255, "No", 255, 93191.404},
+			{103, 255, "Lr", 255, 96562.404},
+			{100, 256, "Fm", 256, 91773.878},
+			{102, 256, "No", 256, 94280.866},
+			{103, 256, "Lr", 256, 98494.029},
+			{104, 256, "Rf", 256, 101151.535},
+			{100, 257, "Fm", 257, 95105.317},
+			{101, 257, "Md", 257, 95537.977},
+			{102, 257, "No", 257, 96884.419},
+			{104, 257, "Rf", 257, 102916.848},
+			{101, 258, "Md", 258, 98429.825},
+			{104, 258, "Rf", 258, 103426.362},
+			{102, 259, "No", 259, 100997.503},
+			{105, 259, "Db", 259, 109491.865},
+			{106, 260, "Sg", 260, 114383.508},
+			{104, 261, "Rf", 261, 108769.990},
+			{106, 261, "Sg", 261, 115948.188},
+			{106, 262, "Sg", 262, 116335.446},
+			{108, 264, "Hs", 264, 128356.405},
+			{108, 265, "Hs", 265, 129791.799},
+			{108, 266, "Hs", 266, 130045.252},
+			{110, 269, "Ds", 269, 144751.021},
+			{110, 270, "Ds", 270, 144583.090},
+		};
+	}
+
+}
+
+#endif
@@ -0,0 +1,45 @@
+#include "NameTable.h"
+#include <iostream>
+
+namespace NucKage {
+
+	NameTable* NameTable::s_instance = new NameTable();
+
+	NameTable::NameTable()
+	{
+		for(auto& table : m_tables)
+		{
+			table.ids[""] = s_noName;
+			table.names.push_back("");
+		}
+	}
+
+	NameTable::~NameTable() {}
+
+	//Returns the ID of name, adding it to the table if it is new
+	NameID NameTable::Intern(NameKind kind, const std::string& name)
+	{
+		std::lock_guard<std::mutex> guard(m_tableMutex);
+		Table& table = m_tables[static_cast<int>(kind)];
+		auto iter = table.ids.find(name);
+		if(iter != table.ids.end())
+			return iter->second;
+
+		NameID id = table.names.size();
+		table.ids[name] = id;
+		table.names.push_back(name);
+		return id;
+	}
+
+	const std::string& NameTable::Resolve(NameKind kind, NameID id) const
+	{
+		const Table& table = m_tables[static_cast<int>(kind)];
+		if(id >= table.names.size())
+		{
+			std::cerr<<"WARN -- Unable to resolve name with ID "<<id<<"."<<std::endl;
+			return table.names[s_noName];
+		}
+		return table.names[id];
+	}
+
+}
@@ -0,0 +1,59 @@
+/*
+
+NameTable.h
+Global intern table for the names used in events: nuclide symbols, reactor equations, and detector names. Each name is
+stored once and events carry a compact integer ID instead of a string. Names are interned while the role is loaded
+(Nucleus, Reactor and detector construction); once the simulation is running the table is only read, so lookups are
+not locked. ID 0 of every kind is the empty name.
+
+*/
+#ifndef NAME_TABLE_H
+#define NAME_TABLE_H
+
+#include <string>
+#include <deque>
+#include <array>
+#include <unordered_map>
+#include <mutex>
+#include <cstdint>
+
+namespace NucKage {
+
+	using NameID = uint32_t;
+
+	enum class NameKind
+	{
+		Nuclide=0,
+		Reactor=1,
+		Detector=2
+	};
+
+	class NameTable
+	{
+	public:
+		NameTable();
+		~NameTable();
+
+		NameID Intern(NameKind kind, const std::string& name);
+		const std::string& Resolve(NameKind kind, NameID id) const;
+		inline size_t GetNumberOfNames(NameKind kind) const { return m_tables[static_cast<int>(kind)].names.size(); }
+
+		inline static NameTable& GetInstance() { return *s_instance; }
+
+		static constexpr NameID s_noName = 0;
+
+	private:
+		struct Table
+		{
+			std::unordered_map<std::string, NameID> ids;
+			std::deque<std::string> names; //deque so resolved references stay valid while names are added
+		};
+
+		static NameTable* s_instance;
+		std::array<Table, 3> m_tables;
+		std::mutex m_tableMutex;
+	};
+
+}
+
+#endif
@@ -1,8 +1,10 @@
 #ifndef NUCLEUS_H
 #define NUCLEUS_H
 
-#include <TLorentzVector.h>
+#include "Vec4.h"
 #include "MassLookup.h"
+#include "NameTable.h"
+#include <type_traits>
 
 namespace NucKage {
 
@@ -16,7 +18,7 @@ namespace NucKage {
 			A = a;
 			MassLookup& table = MassLookup::GetInstance();
 			mass = table.FindMass(Z, A);
-			symbol = table.FindSymbol(Z, A);
+			symbol = NameTable::GetInstance().Intern(NameKind::Nuclide, table.FindSymbol(Z, A));
 			pvector.SetPxPyPzE(0.,0.,0.,mass);
 		}
 
@@ -26,24 +28,26 @@ namespace NucKage {
 			A = a;
 			MassLookup& table = MassLookup::GetInstance();
 			mass = table.FindMass(Z, A);
-			symbol = table.FindSymbol(Z, A);
+			symbol = NameTable::GetInstance().Intern(NameKind::Nuclide, table.FindSymbol(Z, A));
 			pvector.SetPxPyPzE(0.,0.,0.,mass);
 		}
 
 		int Z=0;
 		int A=0;
 		double mass=0.0;
-		std::string symbol="";
-		TLorentzVector pvector;
+		NameID symbol=NameTable::s_noName;
+		Vec4 pvector;
 
 		//Detector crap
 		bool detected=false;
-		std::string detectorName="";
+		NameID detectorName=NameTable::s_noName;
 		int detectorID=-1;
 		int detectorFrontChannel=-1;
 		int detectorBackChannel=-1;
 		double rho=0.0;
 	};
+
+	static_assert(std::is_trivially_copyable<Nucleus>::value, "Nucleus must be trivially copyable");
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,211 @@
+#include "PlotSet.h"
+#include <algorithm>
+#include <TH2.h>
+#include <TH1.h>
+#include <TGraph.h>
+#include "Detectors/FocalPlaneDetector.h"
+
+namespace NucKage {
+
+	PlotSet::PlotSet() {}
+
+	//Histograms are summed, graphs have the points of other appended
+	void PlotSet::Merge(PlotSet& other)
+	{
+		for(auto& iter : other.m_map)
+		{
+			auto mine = m_map.find(iter.first);
+			if(mine == m_map.end())
+			{
+				m_map[iter.first] = iter.second;
+				continue;
+			}
+
+			auto g = std::dynamic_pointer_cast<TGraph>(mine->second);
+			if(g)
+			{
+				auto other_g = std::static_pointer_cast<TGraph>(iter.second);
+				int offset = g->GetN();
+				g->Set(offset + other_g->GetN());
+				for(int i=0; i<other_g->GetN(); i++)
+					g->SetPoint(offset+i, other_g->GetX()[i], other_g->GetY()[i]);
+				continue;
+			}
+
+			auto h = std::dynamic_pointer_cast<TH1>(mine->second);
+			if(h)
+				h->Add(std::static_pointer_cast<TH1>(iter.second).get());
+		}
+		other.m_map.clear();
+	}
+
+	uint64_t PlotSet::GetSizeBytes() const
+	{
+		uint64_t bytes = 0;
+		for(auto& iter : m_map)
+		{
+			auto g = std::dynamic_pointer_cast<TGraph>(iter.second);
+			if(g)
+			{
+				bytes += 2*sizeof(double)*g->GetN();
+				continue;
+			}
+
+			auto h = std::dynamic_pointer_cast<TH1>(iter.second);
+			if(h)
+				bytes += sizeof(float)*h->GetNcells();
+		}
+		return bytes;
+	}
+
+	void PlotSet::Write()
+	{
+		for(auto& iter : m_map)
+			iter.second->Write();
+	}
+
+	void PlotSet::MyFill2D(const Histo2DParams& params, double valueX, double valueY)
+	{
+		auto h = std::static_pointer_cast<TH2>(m_map[params.name]);
+		if(h) {
+			h->Fill(valueX, valueY);
+		} else {
+			h = std::make_shared<TH2F>(params.name.c_str(), params.name.c_str(), params.binsX, params.minX, params.maxX, params.binsY, params.minY, params.maxY);
+			h->Fill(valueX, valueY);
+			m_map[params.name] = h;
+		}
+	}
+
+	TH1* PlotSet::GetHisto1D(const Histo1DParams& params)
+	{
+		auto& object = m_map[params.name];
+		if(!object)
+			object = std::make_shared<TH1F>(params.name.c_str(), params.name.c_str(), params.binsX, params.minX, params.maxX);
+		return static_cast<TH1*>(object.get());
+	}
+
+	TGraph* PlotSet::GetGraph(const std::string& name, int color)
+	{
+		auto& object = m_map[name];
+		if(!object)
+		{
+			auto g = std::make_shared<TGraph>();
+			g->SetName(name.c_str());
+			g->SetTitle(name.c_str());
+			g->SetMarkerColor(color);
+			object = g;
+		}
+		return static_cast<TGraph*>(object.get());
+	}
+
+	void PlotSet::FillKinematicsBatch(const std::string& prefix, const std::string& suffix, const ParticleColumns& particles,
+									  const std::vector<uint32_t>& selection, int color)
+	{
+		if(selection.empty())
+			return;
+
+		TGraph* theta_g = GetGraph(prefix+"_KEvTheta"+suffix+";#theta_{Lab}(deg);KE (MeV)", color);
+		TGraph* phi_g = GetGraph(prefix+"_KEvPhi"+suffix+";#phi_{Lab}(deg);KE (MeV)", color);
+		int offset = theta_g->GetN();
+		theta_g->Set(offset + selection.size());
+		for(size_t i=0; i<selection.size(); i++)
+		{
+			uint32_t j = selection[i];
+			theta_g->SetPoint(offset+i, particles.Theta(j)*s_rad2deg, particles.E[j] - particles.M(j));
+		}
+		offset = phi_g->GetN();
+		phi_g->Set(offset + selection.size());
+		for(size_t i=0; i<selection.size(); i++)
+		{
+			uint32_t j = selection[i];
+			phi_g->SetPoint(offset+i, FullPhi(particles.Phi(j))*s_rad2deg, particles.E[j] - particles.M(j));
+		}
+	}
+
+	void PlotSet::FillHisto1DBatch(const Histo1DParams& params, const std::vector<double>& values, const std::vector<uint32_t>& selection)
+	{
+		if(selection.empty())
+			return;
+
+		TH1* h = GetHisto1D(params);
+		for(uint32_t j : selection)
+			h->Fill(values[j]);
+	}
+
+	/*
+		Batch version of Fill. Plot names are built and the plots looked up once per reactor per block instead of once per
+		event, the events themselves are then filled in tight loops. Events that were not kinematically allowed (valid == 0)
+		are skipped.
+	*/
+	void PlotSet::FillBatch(const EventBlock& block)
+	{
+		Histo1DParams h1pars;
+		h1pars.binsX = 300, h1pars.minX = 0.0, h1pars.maxX = 30.0;
+		Histo1DParams rhopars;
+		rhopars.binsX = 1400, rhopars.minX = 69.5, rhopars.maxX = 83.5;
+		m_values.resize(block.size);
+		NameTable& names = NameTable::GetInstance();
+
+		for(auto& columns : block.reactors)
+		{
+			std::string prefix = "Chain_"+std::to_string(block.chainID)+"_Rxn_"+names.Resolve(NameKind::Reactor, columns.reactor)+"_Nuc_";
+			m_selection.clear();
+			for(size_t j=0; j<block.size; j++)
+			{
+				if(columns.valid[j])
+					m_selection.push_back(j);
+			}
+
+			const SlotInfo& target_info = columns.info[ReactorColumns::Target];
+			const ParticleColumns& target = columns.particles[ReactorColumns::Target];
+			FillKinematicsBatch(prefix+names.Resolve(NameKind::Nuclide, target_info.symbol), "", target, m_selection, 2);
+			for(uint32_t j : m_selection)
+				m_values[j] = target.M(j) - target_info.mass;
+			h1pars.name = prefix+names.Resolve(NameKind::Nuclide, target_info.symbol)+"_Ex;E_{x} (MeV);counts";
+			FillHisto1DBatch(h1pars, m_values, m_selection);
+
+			const SlotInfo& ejectile_info = columns.info[ReactorColumns::Ejectile];
+			const ParticleColumns& ejectile = columns.particles[ReactorColumns::Ejectile];
+			FillKinematicsBatch(prefix+names.Resolve(NameKind::Nuclide, ejectile_info.symbol), "", ejectile, m_selection, 4);
+
+			const SlotInfo& residual_info = columns.info[ReactorColumns::Residual];
+			const ParticleColumns& residual = columns.particles[ReactorColumns::Residual];
+			FillKinematicsBatch(prefix+names.Resolve(NameKind::Nuclide, residual_info.symbol), "", residual, m_selection, 5);
+			for(uint32_t j : m_selection)
+				m_values[j] = residual.M(j) - residual_info.mass;
+			h1pars.name = prefix+names.Resolve(NameKind::Nuclide, residual_info.symbol)+"_Ex;E_{x} (MeV);counts";
+			FillHisto1DBatch(h1pars, m_values, m_selection);
+
+			const SlotInfo& projectile_info = columns.info[ReactorColumns::Projectile];
+			if(projectile_info.active)
+			{
+				const ParticleColumns& projectile = columns.particles[ReactorColumns::Projectile];
+				FillKinematicsBatch(prefix+names.Resolve(NameKind::Nuclide, projectile_info.symbol), "", projectile, m_selection, 3);
+				for(uint32_t j : m_selection)
+					m_values[j] = projectile.E[j] - projectile.M(j);
+				h1pars.name = prefix+names.Resolve(NameKind::Nuclide, projectile_info.symbol)+"_KE;KE (MeV);counts";
+				FillHisto1DBatch(h1pars, m_values, m_selection);
+			}
+
+			//Detected ejectiles and residuals, with the focal plane rho spectrum
+			for(auto slot : {ReactorColumns::Ejectile, ReactorColumns::Residual})
+			{
+				const SlotInfo& info = columns.info[slot];
+				const ParticleColumns& particles = columns.particles[slot];
+				m_selection.clear();
+				for(size_t j=0; j<block.size; j++)
+				{
+					if(columns.valid[j] && particles.detected[j])
+						m_selection.push_back(j);
+				}
+				FillKinematicsBatch(prefix+names.Resolve(NameKind::Nuclide, info.symbol), "_detect", particles, m_selection, 4);
+
+				m_selection.erase(std::remove_if(m_selection.begin(), m_selection.end(), [&particles](uint32_t j) {
+					return particles.detectorID[j] != FocalPlaneDetector::GetDetectorID();
+				}), m_selection.end());
+				rhopars.name = prefix+names.Resolve(NameKind::Nuclide, info.symbol)+"_rho;#rho (cm);counts";
+				FillHisto1DBatch(rhopars, particles.rho, m_selection);
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#ifndef PLOT_SET_H
+#define PLOT_SET_H
+
+#include <string>
+#include <unordered_map>
+#include <memory>
+#include <TObject.h>
+#include "ReactorChain.h"
+#include "EventBlock.h"
+
+class TH1;
+class TGraph;
+
+namespace NucKage {
+
+	/*
+		A private collection of histograms and graphs. Each chunk of samples fills its own PlotSet
+		(no locking, no sharing between threads) and the sets are merged by the RootPlotter once
+		simulation is done.
+	*/
+	class PlotSet
+	{
+	public:
+		PlotSet();
+
+		void FillBatch(const EventBlock& block); //Kinematics and detection plots of every valid event of the block
+		void Merge(PlotSet& other); //Steals or adds the contents of other; other is left empty
+		void Write();
+		uint64_t GetSizeBytes() const; //Approximate memory held by the histogram and graph contents
+		inline bool IsEmpty() const { return m_map.empty(); }
+
+	private:
+		static constexpr double s_rad2deg = 180.0/M_PI;
+
+		struct Histo2DParams
+		{
+			std::string name;
+			int binsX=0;
+			int binsY=0;
+			double minY=0.0;
+			double minX=0.0;
+			double maxX=0.0;
+			double maxY=0.0;
+		};
+		struct Histo1DParams
+		{
+			std::string name;
+			int binsX=0;
+			double minX=0.0;
+			double maxX=0.0;
+		};
+
+		inline double FullPhi(double phi) { return phi >= 0.0 ? phi : 2.0*M_PI+phi; }
+
+		void MyFill2D(const Histo2DParams& params, double valueX, double valueY);
+
+		TH1* GetHisto1D(const Histo1DParams& params);
+		TGraph* GetGraph(const std::string& name, int color);
+		void FillKinematicsBatch(const std::string& prefix, const std::string& suffix, const ParticleColumns& particles,
+								 const std::vector<uint32_t>& selection, int color);
+		void FillHisto1DBatch(const Histo1DParams& params, const std::vector<double>& values, const std::vector<uint32_t>& selection);
+
+		std::unordered_map<std::string, std::shared_ptr<TObject>> m_map;
+		std::vector<uint32_t> m_selection; //indices of the events a batch fill applies to
+		std::vector<double> m_values;
+	};
+
+}
+
+#endif
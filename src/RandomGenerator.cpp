@@ -1,12 +1,65 @@
 #include "RandomGenerator.h"
+#include <cmath>
 
 namespace NucKage {
 
-	RandomGenerator::RandomGenerator() 
+	uint64_t RandomGenerator::s_runSeed = 0;
+
+	//Threads start on a stream of their own (chain ID 0 is never used by a ReactorChain), until given a chain/chunk stream
+	RandomGenerator::RandomGenerator() :
+		m_uniformIndex(s_blockSize), m_normalIndex(s_blockSize), m_directionIndex(s_blockSize)
 	{
 		std::random_device rd;
-		rng.seed(rd());
+		rng.SetStream(GenerateRunSeed(), 0, rd());
 	}
 
 	RandomGenerator::~RandomGenerator() {}
-}
\ No newline at end of file
+
+	uint64_t RandomGenerator::GenerateRunSeed()
+	{
+		std::random_device rd;
+		return (uint64_t(rd()) << 32) | rd();
+	}
+
+	//53 random bits per double, two 32-bit words each
+	void RandomGenerator::FillUniforms(double* values, size_t n)
+	{
+		static constexpr double s_norm = 1.0/9007199254740992.0; //2^-53
+		rng.Fill(m_raw.data(), n/2);
+		for(size_t i=0; i<n; i++)
+			values[i] = ((uint64_t(m_raw[2*i] >> 5) << 26) + (m_raw[2*i+1] >> 6))*s_norm;
+	}
+
+	//Box-Muller, both outputs of each pair are used
+	void RandomGenerator::FillNormals()
+	{
+		static constexpr double s_twoPi = 2.0*M_PI;
+		FillUniforms(m_scratch.data(), s_blockSize);
+		for(size_t i=0; i<s_blockSize; i+=2)
+		{
+			double radius = std::sqrt(-2.0*std::log(1.0 - m_scratch[i])); //1-u is in (0, 1]
+			double angle = s_twoPi*m_scratch[i+1];
+			m_normals[i] = radius*std::cos(angle);
+			m_normals[i+1] = radius*std::sin(angle);
+		}
+		m_normalIndex = 0;
+	}
+
+	//cos(theta) uniform in [-1, 1), phi uniform in [0, 2pi)
+	void RandomGenerator::FillDirections()
+	{
+		static constexpr double s_twoPi = 2.0*M_PI;
+		FillUniforms(m_scratch.data(), s_blockSize);
+		FillUniforms(m_directionZ.data(), s_blockSize);
+		for(size_t i=0; i<s_blockSize; i++)
+		{
+			double cosTheta = 2.0*m_directionZ[i] - 1.0;
+			double sinTheta = std::sqrt(1.0 - cosTheta*cosTheta);
+			double phi = s_twoPi*m_scratch[i];
+			m_directionX[i] = sinTheta*std::cos(phi);
+			m_directionY[i] = sinTheta*std::sin(phi);
+			m_directionZ[i] = cosTheta;
+		}
+		m_directionIndex = 0;
+	}
+}
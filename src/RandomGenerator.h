@@ -4,15 +4,151 @@
 #include <random>
 #include <thread>
 #include <mutex>
+#include <array>
+#include <cstdint>
 
 namespace NucKage {
 
+	/*
+		Counter-based generator (Philox4x32-10, Salmon et al., SC11). Each output block is a pure function of
+		(key, counter), so a stream is fully defined by its key and the fixed part of its counter; there is no hidden
+		state to carry between threads. NucKage keys the generator with the run seed and puts (chain ID, chunk index)
+		in the upper half of the counter, the lower half counts blocks within the stream.
+		Satisfies UniformRandomBitGenerator so it works with the std distributions.
+	*/
+	class Philox4x32
+	{
+	public:
+		using result_type = uint32_t;
+		using Block = std::array<uint32_t, 4>;
+
+		Philox4x32() :
+			Philox4x32(0, 0, 0)
+		{
+		}
+
+		Philox4x32(uint64_t seed, uint32_t streamHi, uint32_t streamLo)
+		{
+			SetStream(seed, streamHi, streamLo);
+		}
+
+		inline void SetStream(uint64_t seed, uint32_t streamHi, uint32_t streamLo)
+		{
+			m_key = { uint32_t(seed), uint32_t(seed >> 32) };
+			m_counter = { 0, 0, streamLo, streamHi };
+			m_index = 4;
+		}
+
+		inline result_type operator()()
+		{
+			if(m_index == 4)
+			{
+				m_output = Generate(m_counter, m_key);
+				if(++m_counter[0] == 0)
+					++m_counter[1];
+				m_index = 0;
+			}
+			return m_output[m_index++];
+		}
+
+		//Bulk generation for the block buffers: nblocks consecutive blocks, 4*nblocks words, written to out
+		inline void Fill(uint32_t* out, size_t nblocks)
+		{
+			for(size_t i=0; i<nblocks; i++)
+			{
+				Block block = Generate(m_counter, m_key);
+				out[4*i] = block[0];
+				out[4*i+1] = block[1];
+				out[4*i+2] = block[2];
+				out[4*i+3] = block[3];
+				if(++m_counter[0] == 0)
+					++m_counter[1];
+			}
+		}
+
+		static constexpr result_type min() { return 0; }
+		static constexpr result_type max() { return UINT32_MAX; }
+
+		static inline Block Generate(Block counter, std::array<uint32_t, 2> key)
+		{
+			for(int i=0; i<10; i++)
+			{
+				if(i != 0)
+				{
+					key[0] += s_weyl0;
+					key[1] += s_weyl1;
+				}
+				uint64_t product0 = uint64_t(s_mult0) * counter[0];
+				uint64_t product1 = uint64_t(s_mult1) * counter[2];
+				counter = { uint32_t(product1 >> 32) ^ counter[1] ^ key[0], uint32_t(product1),
+							uint32_t(product0 >> 32) ^ counter[3] ^ key[1], uint32_t(product0) };
+			}
+			return counter;
+		}
+
+	private:
+		static constexpr uint32_t s_mult0 = 0xD2511F53;
+		static constexpr uint32_t s_mult1 = 0xCD9E8D57;
+		static constexpr uint32_t s_weyl0 = 0x9E3779B9;
+		static constexpr uint32_t s_weyl1 = 0xBB67AE85;
+
+		std::array<uint32_t, 2> m_key;
+		Block m_counter;
+		Block m_output;
+		int m_index;
+	};
+
+	/*
+		Per-thread random number service. Besides the raw generator (for the std distributions), it hands out
+		uniforms, standard normals and isotropic unit vectors from buffers that are refilled a block at a time in
+		tight loops over the Philox output, which is much cheaper than drawing each value through a std distribution.
+	*/
 	class RandomGenerator {
 	public:
 		RandomGenerator();
 		~RandomGenerator();
 		
-		inline std::mt19937& GetGenerator() { return rng; }
+		inline Philox4x32& GetGenerator() { return rng; }
+		//Point this thread's generator at the stream for (run seed, chain, chunk). Buffered values from the old stream are dropped.
+		inline void SetStream(uint32_t chainID, uint32_t chunk)
+		{
+			rng.SetStream(s_runSeed, chainID, chunk);
+			m_uniformIndex = s_blockSize;
+			m_normalIndex = s_blockSize;
+			m_directionIndex = s_blockSize;
+		}
+
+		//[0, 1)
+		inline double Uniform()
+		{
+			if(m_uniformIndex == s_blockSize)
+				FillUniforms();
+			return m_uniforms[m_uniformIndex++];
+		}
+
+		//Standard normal (mean 0, sigma 1)
+		inline double Normal()
+		{
+			if(m_normalIndex == s_blockSize)
+				FillNormals();
+			return m_normals[m_normalIndex++];
+		}
+
+		//Unit vector uniformly distributed over the sphere
+		inline void IsotropicDirection(double& x, double& y, double& z)
+		{
+			if(m_directionIndex == s_blockSize)
+				FillDirections();
+			x = m_directionX[m_directionIndex];
+			y = m_directionY[m_directionIndex];
+			z = m_directionZ[m_directionIndex];
+			m_directionIndex++;
+		}
+
+		inline static void SetRunSeed(uint64_t seed) { s_runSeed = seed; }
+		inline static uint64_t GetRunSeed() { return s_runSeed; }
+		static uint64_t GenerateRunSeed();
+
 		inline static RandomGenerator& GetInstance()
 		{
 			thread_local RandomGenerator s_generator; //implicitly static
@@ -20,9 +156,29 @@ namespace NucKage {
 		}
 
 	private:
-		std::mt19937 rng;
+		static constexpr size_t s_blockSize = 256; //values per buffer refill, must be even
+
+		void FillUniforms(double* values, size_t n);
+		inline void FillUniforms() { FillUniforms(m_uniforms.data(), s_blockSize); m_uniformIndex = 0; }
+		void FillNormals();
+		void FillDirections();
+
+		Philox4x32 rng;
+
+		std::array<uint32_t, 2*s_blockSize> m_raw;
+		std::array<double, s_blockSize> m_uniforms;
+		std::array<double, s_blockSize> m_normals;
+		std::array<double, s_blockSize> m_directionX;
+		std::array<double, s_blockSize> m_directionY;
+		std::array<double, s_blockSize> m_directionZ;
+		std::array<double, s_blockSize> m_scratch;
+		size_t m_uniformIndex;
+		size_t m_normalIndex;
+		size_t m_directionIndex;
+
+		static uint64_t s_runSeed;
 	};
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -1,5 +1,7 @@
 #include "Reactor.h"
+#include "TwoBodyKernel.h"
 #include <iostream>
+#include <algorithm>
 
 namespace NucKage {
 
@@ -43,151 +45,257 @@ namespace NucKage {
 				m_type = Type::None;
 			}
 		}
+
+		//Interned once here, so that compiling plans (on the worker copies of a chain) never touches the name table
+		m_equation = NameTable::GetInstance().Intern(NameKind::Reactor, GetEquation());
+
+		PlanConditions conditions;
+		conditions.targetMass = GetTarget().mass;
+		CompilePlan(conditions);
 	}
 
 	Reactor::~Reactor() {}
 
 	const std::string Reactor::GetEquation() const
 	{
+		auto symbol = [this](int i) { return NameTable::GetInstance().Resolve(NameKind::Nuclide, m_reactants[i].symbol); };
 		switch(m_type)
 		{
 			case Type::Decay:
-				return m_reactants[0].symbol + "->" + m_reactants[1].symbol + "+" + m_reactants[2].symbol;
+				return symbol(0) + "->" + symbol(1) + "+" + symbol(2);
 			case Type::Reaction:
-				return m_reactants[0].symbol + "(" + m_reactants[1].symbol + "," + m_reactants[2].symbol + ")" + m_reactants[3].symbol;
+				return symbol(0) + "(" + symbol(1) + "," + symbol(2) + ")" + symbol(3);
 			case Type::None:
 				return "None";
 		}
 		return "None";
 	}
 
-	ReactorProducts Reactor::GenerateProducts(const ReactionParameters& params)
+	//The beam and ejectile are the species sent through the target, their stopping power is tabulated once here
+	void Reactor::BindTarget(Target* target)
 	{
-		switch(m_type)
+		m_target = target;
+		m_beamHandle = Target::ProjectileHandle();
+		m_ejectileHandle = Target::ProjectileHandle();
+		if(m_target == nullptr || m_target->GetTotalThickness() == 0.0)
+			return;
+
+		if(m_type == Type::Reaction)
 		{
-			case Type::Decay: return CalculateDecay(params);
-			case Type::Reaction: return CalculateReaction(params);
-			case Type::None: return ReactorProducts();
+			m_beamHandle = m_target->RegisterProjectile(m_reactants[1].Z, m_reactants[1].A);
+			m_ejectileHandle = m_target->RegisterProjectile(m_reactants[2].Z, m_reactants[2].A);
 		}
-
-		return ReactorProducts();
+		else if(m_type == Type::Decay)
+			m_ejectileHandle = m_target->RegisterProjectile(m_reactants[1].Z, m_reactants[1].A);
 	}
 
-	ReactorProducts Reactor::CalculateReaction(const ReactionParameters& params)
+	/*
+		Everything about the kinematics which does not change from event to event. If the CM energy of the ejectile is also
+		fixed (no spread in beam energy, no beam energy loss, no spread in excitation, a target at rest or a parent of fixed
+		mass) it is calculated here as well, and GenerateBatch skips the per-event mass and CM momentum calculation.
+	*/
+	void Reactor::CompilePlan(const PlanConditions& conditions)
 	{
-		ReactorProducts prods;
-		prods.reactorName = GetEquation();
-		double beamE, beamPz;
-		if(m_target) //if target do energy loss
+		m_plan = ReactorPlan();
+		m_plan.equation = m_equation;
+		m_plan.applyEnergyLoss = m_target != nullptr && m_target->GetTotalThickness() > 0.0;
+		if(m_type == Type::Reaction)
 		{
-			double beamKE = params.beamEnergy;
-			beamKE -= m_target->GetEnergyLossFractionalDepth(m_reactants[1].Z, m_reactants[1].A, beamKE, 0.0, params.targetFraction);
-			beamPz = std::sqrt(beamKE*(beamKE + 2.0*m_reactants[1].mass));
-			beamE = beamKE + m_reactants[1].mass;
+			const double targMass = m_reactants[0].mass, projMass = m_reactants[1].mass;
+			const double ejectMass = m_reactants[2].mass, residMass = m_reactants[3].mass;
+			m_plan.ejectileMass2 = ejectMass*ejectMass;
+			m_plan.residualMass2 = residMass*residMass;
+			m_plan.groundStateQ = targMass + projMass - (ejectMass + residMass);
+			m_plan.thresholdCoefficient = (ejectMass + residMass)/(ejectMass + residMass - projMass);
+
+			m_plan.fixedCM = conditions.targetAtRest && conditions.fixedTargetMass && conditions.fixedBeamEnergy &&
+							 conditions.fixedExcitation && !m_plan.applyEnergyLoss;
+			if(m_plan.fixedCM)
+			{
+				double beamKE = conditions.beamEnergy;
+				double parentE = conditions.targetMass + projMass + beamKE;
+				double parentM2 = parentE*parentE - beamKE*(beamKE + 2.0*projMass);
+				double residEx = residMass + conditions.excitation;
+				double Q = conditions.targetMass + projMass - (ejectMass + residEx);
+				m_plan.fixedAllowed = beamKE >= -Q*m_plan.thresholdCoefficient;
+				m_plan.ejectileE_cm = (m_plan.ejectileMass2 - residEx*residEx + parentM2)/(2.0*std::sqrt(parentM2));
+				m_plan.ejectileP_cm = std::sqrt(m_plan.ejectileE_cm*m_plan.ejectileE_cm - m_plan.ejectileMass2);
+			}
+		}
+		else if(m_type == Type::Decay)
+		{
+			const double parentMass = m_reactants[0].mass, ejectMass = m_reactants[1].mass, residMass = m_reactants[2].mass;
+			m_plan.ejectileMass2 = ejectMass*ejectMass;
+			m_plan.residualMass2 = residMass*residMass;
+			m_plan.groundStateQ = parentMass - ejectMass - residMass;
+
+			m_plan.fixedCM = conditions.fixedTargetMass;
+			if(m_plan.fixedCM)
+			{
+				double parentM = conditions.targetMass;
+				m_plan.fixedAllowed = parentM - ejectMass - residMass >= 0.0;
+				m_plan.ejectileE_cm = (m_plan.ejectileMass2 - m_plan.residualMass2 + parentM*parentM)/(2.0*parentM);
+				m_plan.ejectileP_cm = std::sqrt(m_plan.ejectileE_cm*m_plan.ejectileE_cm - m_plan.ejectileMass2);
+			}
 		}
+	}
+
+	void Reactor::SetupColumns(ReactorColumns& columns) const
+	{
+		columns.reactor = m_plan.equation;
+		for(auto& info : columns.info)
+			info = SlotInfo();
+
+		std::array<int, 4> slots;
+		if(m_type == Type::Reaction)
+			slots = { ReactorColumns::Target, ReactorColumns::Projectile, ReactorColumns::Ejectile, ReactorColumns::Residual };
+		else if(m_type == Type::Decay)
+			slots = { ReactorColumns::Target, ReactorColumns::Ejectile, ReactorColumns::Residual, -1 };
 		else
+			return;
+
+		for(size_t i=0; i<m_reactants.size(); i++)
+		{
+			SlotInfo& info = columns.info[slots[i]];
+			info.active = true;
+			info.Z = m_reactants[i].Z;
+			info.A = m_reactants[i].A;
+			info.mass = m_reactants[i].mass;
+			info.symbol = m_reactants[i].symbol;
+		}
+	}
+
+	/*
+		Reaction or decay kinematics, one stage at a time over the whole block. Expects the target columns and the
+		valid flags to be filled by the caller (the residual of the previous reactor, or the target at rest).
+	*/
+	void Reactor::GenerateBatch(ReactorColumns& columns, const std::vector<double>& targetFraction, size_t n)
+	{
+		switch(m_type)
 		{
-			beamPz = std::sqrt(params.beamEnergy*(params.beamEnergy + 2.0 * m_reactants[1].mass));
-			beamE = params.beamEnergy + m_reactants[1].mass;
+			case Type::Decay: GenerateBatchAs<Type::Decay>(columns, targetFraction, n); break;
+			case Type::Reaction: GenerateBatchAs<Type::Reaction>(columns, targetFraction, n); break;
+			case Type::None: GenerateBatchAs<Type::None>(columns, targetFraction, n); break;
 		}
-		m_reactants[1].pvector.SetPxPyPzE(0.,0.,beamPz,beamE);
-
-	
-	
-		double Q = m_reactants[0].pvector.M() + m_reactants[1].mass - (m_reactants[2].mass + m_reactants[3].mass + params.excitationEnergy);
-	
-		double Ethresh = -Q*(m_reactants[2].mass+m_reactants[3].mass)/(m_reactants[2].mass + m_reactants[3].mass - m_reactants[1].mass);
-		if(params.beamEnergy < Ethresh)
+	}
+
+	void Reactor::CalculateReactionBatch(ReactorColumns& columns, const std::vector<double>& targetFraction, size_t n)
+	{
+		ParticleColumns& targ = columns.particles[ReactorColumns::Target];
+		ParticleColumns& proj = columns.particles[ReactorColumns::Projectile];
+		ParticleColumns& eject = columns.particles[ReactorColumns::Ejectile];
+		ParticleColumns& resid = columns.particles[ReactorColumns::Residual];
+		const double projMass = m_reactants[1].mass;
+		const double ejectMass = m_reactants[2].mass;
+		const double residMass = m_reactants[3].mass;
+
+		//Beam energy loss up to the reaction location
+		m_energyLoss.resize(n);
+		if(m_plan.applyEnergyLoss)
+			m_target->GetBeamEnergyLossBatch(m_beamHandle, columns.beamEnergy.data(), targetFraction.data(), m_energyLoss.data(), n);
+		else
+			std::fill(m_energyLoss.begin(), m_energyLoss.end(), 0.0);
+		for(size_t i=0; i<n; i++)
 		{
-			return prods;
+			double beamKE = columns.beamEnergy[i] - m_energyLoss[i];
+			proj.px[i] = 0.0;
+			proj.py[i] = 0.0;
+			proj.pz[i] = std::sqrt(beamKE*(beamKE + 2.0*projMass));
+			proj.E[i] = beamKE + projMass;
 		}
-		
-		auto parent = m_reactants[0].pvector + m_reactants[1].pvector;
-		auto boost = parent.BoostVector();
-		parent.Boost(-1.0*boost);
-		double ejectE_cm = (std::pow(m_reactants[2].mass, 2.0) - std::pow(m_reactants[3].mass + params.excitationEnergy, 2.0) +
-							std::pow(parent.E(),2.0))/(2.0*parent.E());
-		double ejectP_cm = std::sqrt(ejectE_cm*ejectE_cm - std::pow(m_reactants[2].mass, 2.0));
-		m_reactants[2].pvector.SetPxPyPzE(ejectP_cm*std::sin(params.thetaCM)*std::cos(params.phiCM),
-										  ejectP_cm*std::sin(params.thetaCM)*std::sin(params.phiCM),
-										  ejectP_cm*std::cos(params.thetaCM),
-										  ejectE_cm);
-		m_reactants[2].pvector.Boost(boost);
-		m_reactants[3].pvector = m_reactants[0].pvector + m_reactants[1].pvector - m_reactants[2].pvector;
-
-		if(m_target) // ejectile energy loss
+
+		//Thresholds, and the parent (target + projectile) which is stored in the residual columns until the kernel replaces it
+		const double targMass = m_reactants[0].mass;
+		for(size_t i=0; i<n; i++)
 		{
-			double ejectKE = m_reactants[2].pvector.E() - m_reactants[2].pvector.M();
-			double percent_depth = params.targetFraction;
-			double ejectTheta = m_reactants[2].pvector.Theta();
-			double ejectPhi = m_reactants[2].pvector.Phi();
-			if(ejectTheta < M_PI/2.0) //forwards through target (other fraction)
-				percent_depth = 1.0 - percent_depth;
-			ejectKE -= m_target->GetEnergyLossFractionalDepth(m_reactants[2].Z, m_reactants[2].A, ejectKE, ejectTheta, params.targetFraction);
-			double ejectP = std::sqrt(ejectKE*(ejectKE + 2.0*m_reactants[2].pvector.M()));
-			double ejectE = ejectKE + m_reactants[2].pvector.M();
-			m_reactants[2].pvector.SetPxPyPzE(ejectP*std::sin(ejectTheta)*std::cos(ejectPhi),
-											  ejectP*std::sin(ejectTheta)*std::sin(ejectPhi),
-											  ejectP*std::cos(ejectTheta),
-											  ejectE);
+			if(m_plan.fixedCM)
+				columns.valid[i] &= m_plan.fixedAllowed;
+			else
+			{
+				double Q = m_plan.groundStateQ + (targ.M(i) - targMass) - columns.excitation[i];
+				if(columns.beamEnergy[i] < -Q*m_plan.thresholdCoefficient)
+					columns.valid[i] = 0;
+			}
+
+			resid.px[i] = targ.px[i] + proj.px[i];
+			resid.py[i] = targ.py[i] + proj.py[i];
+			resid.pz[i] = targ.pz[i] + proj.pz[i];
+			resid.E[i] = targ.E[i] + proj.E[i];
 		}
 
-		prods.target = m_reactants[0];
-		prods.projectile = m_reactants[1];
-		prods.ejectile = m_reactants[2];
-		prods.residual = m_reactants[3];
+		TwoBodyColumns kernel;
+		kernel.parentPx = resid.px.data(), kernel.parentPy = resid.py.data(), kernel.parentPz = resid.pz.data(), kernel.parentE = resid.E.data();
+		kernel.residualExcitation = columns.excitation.data();
+		kernel.directionX = columns.directionX.data(), kernel.directionY = columns.directionY.data(), kernel.directionZ = columns.directionZ.data();
+		kernel.ejectilePx = eject.px.data(), kernel.ejectilePy = eject.py.data(), kernel.ejectilePz = eject.pz.data(), kernel.ejectileE = eject.E.data();
+		kernel.residualPx = resid.px.data(), kernel.residualPy = resid.py.data(), kernel.residualPz = resid.pz.data(), kernel.residualE = resid.E.data();
+		if(m_plan.fixedCM)
+			CalculateTwoBodyFixedCM(kernel, m_plan.ejectileE_cm, m_plan.ejectileP_cm, n);
+		else
+			CalculateTwoBody(kernel, ejectMass, residMass, n);
 
-		return prods;
+		if(m_plan.applyEnergyLoss)
+			ApplyEjectileEnergyLossBatch(eject, columns.valid, targetFraction, n);
 	}
 
-	ReactorProducts Reactor::CalculateDecay(const ReactionParameters& params)
+	void Reactor::CalculateDecayBatch(ReactorColumns& columns, const std::vector<double>& targetFraction, size_t n)
 	{
-		ReactorProducts prods;
-		prods.reactorName = GetEquation();
-		double Q = m_reactants[0].pvector.M() - m_reactants[1].mass - m_reactants[2].mass;
-		if(Q < 0)
+		ParticleColumns& targ = columns.particles[ReactorColumns::Target];
+		ParticleColumns& eject = columns.particles[ReactorColumns::Ejectile];
+		ParticleColumns& resid = columns.particles[ReactorColumns::Residual];
+		const double ejectMass = m_reactants[1].mass;
+		const double residMass = m_reactants[2].mass;
+
+		const double parentMass = m_reactants[0].mass;
+		for(size_t i=0; i<n; i++)
 		{
-			return prods;
+			if(m_plan.fixedCM)
+				columns.valid[i] &= m_plan.fixedAllowed;
+			else if(m_plan.groundStateQ + (targ.M(i) - parentMass) < 0)
+				columns.valid[i] = 0;
 		}
-	
-		auto boost = m_reactants[0].pvector.BoostVector();
-		m_reactants[0].pvector.Boost(-1.0*boost);
-		double ejectE_cm = (m_reactants[1].mass*m_reactants[1].mass - m_reactants[2].mass*m_reactants[2].mass + 
-							m_reactants[0].pvector.E()*m_reactants[0].pvector.E())/(2.0*m_reactants[0].pvector.E());
-		double ejectP_cm = std::sqrt(ejectE_cm*ejectE_cm - m_reactants[1].mass*m_reactants[1].mass);
-	
-		m_reactants[1].pvector.SetPxPyPzE(ejectP_cm*std::sin(params.thetaCM)*std::cos(params.phiCM),
-										  ejectP_cm*std::sin(params.thetaCM)*std::sin(params.phiCM),
-										  ejectP_cm*std::cos(params.thetaCM),
-										  ejectE_cm);
-	
-		m_reactants[0].pvector.Boost(boost);
-		m_reactants[1].pvector.Boost(boost);
-	
-		m_reactants[2].pvector = m_reactants[0].pvector - m_reactants[1].pvector;
-
-		
-		if(m_target) //ejectile energy loss
+
+		TwoBodyColumns kernel;
+		kernel.parentPx = targ.px.data(), kernel.parentPy = targ.py.data(), kernel.parentPz = targ.pz.data(), kernel.parentE = targ.E.data();
+		kernel.directionX = columns.directionX.data(), kernel.directionY = columns.directionY.data(), kernel.directionZ = columns.directionZ.data();
+		kernel.ejectilePx = eject.px.data(), kernel.ejectilePy = eject.py.data(), kernel.ejectilePz = eject.pz.data(), kernel.ejectileE = eject.E.data();
+		kernel.residualPx = resid.px.data(), kernel.residualPy = resid.py.data(), kernel.residualPz = resid.pz.data(), kernel.residualE = resid.E.data();
+		if(m_plan.fixedCM)
+			CalculateTwoBodyFixedCM(kernel, m_plan.ejectileE_cm, m_plan.ejectileP_cm, n);
+		else
+			CalculateTwoBody(kernel, ejectMass, residMass, n);
+
+		if(m_plan.applyEnergyLoss)
+			ApplyEjectileEnergyLossBatch(eject, columns.valid, targetFraction, n);
+	}
+
+	//Slow the ejectile down along its direction of flight from the reaction point out of the target, as the per-event path
+	void Reactor::ApplyEjectileEnergyLossBatch(ParticleColumns& ejectile, const std::vector<uint8_t>& valid, const std::vector<double>& targetFraction,
+											   size_t n)
+	{
+		//Invalid events get no kinetic energy, which the energy loss skips
+		m_energyLossKE.resize(n);
+		m_energyLossTheta.resize(n);
+		m_energyLoss.resize(n);
+		for(size_t i=0; i<n; i++)
 		{
-			double ejectKE = m_reactants[1].pvector.E() - m_reactants[1].pvector.M();
-			double percent_depth = params.targetFraction;
-			double ejectTheta = m_reactants[1].pvector.Theta();
-			double ejectPhi = m_reactants[1].pvector.Phi();
-			if(ejectTheta < M_PI/2.0) //forwards through target (other fraction)
-				percent_depth = 1.0 - percent_depth;
-			ejectKE -= m_target->GetEnergyLossFractionalDepth(m_reactants[1].Z, m_reactants[1].A, ejectKE, ejectTheta, params.targetFraction);
-			double ejectP = std::sqrt(ejectKE*(ejectKE + 2.0*m_reactants[1].pvector.M()));
-			double ejectE = ejectKE + m_reactants[1].pvector.M();
-			m_reactants[1].pvector.SetPxPyPzE(ejectP*std::sin(ejectTheta)*std::cos(ejectPhi),
-											  ejectP*std::sin(ejectTheta)*std::sin(ejectPhi),
-											  ejectP*std::cos(ejectTheta),
-											  ejectE);
+			m_energyLossKE[i] = valid[i] ? ejectile.E[i] - ejectile.M(i) : 0.0;
+			m_energyLossTheta[i] = valid[i] ? ejectile.Theta(i) : 0.0;
 		}
+		m_target->GetEjectileEnergyLossBatch(m_ejectileHandle, m_energyLossKE.data(), m_energyLossTheta.data(), targetFraction.data(), m_energyLoss.data(), n);
 
-		prods.target = m_reactants[0];
-		prods.ejectile = m_reactants[1];
-		prods.residual = m_reactants[2];
-
-		return prods;
+		for(size_t i=0; i<n; i++)
+		{
+			if(!valid[i])
+				continue;
+			double mass = ejectile.M(i);
+			double ejectKE = m_energyLossKE[i] - m_energyLoss[i];
+			double ejectP = ejectile.P(i);
+			double scale = ejectP > 0.0 ? std::sqrt(ejectKE*(ejectKE + 2.0*mass))/ejectP : 0.0;
+			ejectile.px[i] *= scale;
+			ejectile.py[i] *= scale;
+			ejectile.pz[i] *= scale;
+			ejectile.E[i] = ejectKE + mass;
+		}
 	}
 }
\ No newline at end of file
@@ -3,27 +3,38 @@
 
 #include <vector>
 #include <iostream>
+#include <atomic>
 #include "Nucleus.h"
+#include "EventBlock.h"
 #include "EnergyLoss/Target.h"
 
 namespace NucKage {
 
-	struct ReactionParameters
+	//What is known to be the same for every event when a plan is compiled (see ReactorChain::BindTarget)
+	struct PlanConditions
 	{
-		double beamEnergy; //MeV
-		double thetaCM; //radians
-		double phiCM; //radians
-		double excitationEnergy;
-		double targetFraction; //percentage from upstream to downstream (percent of target travelled by beam to get to rxn)
+		bool targetAtRest=true; //only the first reactor of a chain has a target at rest
+		bool fixedTargetMass=true;
+		double targetMass=0.0;
+		bool fixedBeamEnergy=false;
+		double beamEnergy=0.0;
+		bool fixedExcitation=false;
+		double excitation=0.0;
 	};
 
-	struct ReactorProducts
+	//Event-invariant quantities of a reactor, computed once instead of once per event
+	struct ReactorPlan
 	{
-		std::string reactorName;
-		Nucleus target;
-		Nucleus projectile;
-		Nucleus ejectile;
-		Nucleus residual;
+		NameID equation=NameTable::s_noName; //interned, see NameTable
+		double ejectileMass2=0.0;
+		double residualMass2=0.0;
+		double groundStateQ=0.0; //Q-value with every nucleus in its ground state
+		double thresholdCoefficient=0.0; //E_threshold = -Q*thresholdCoefficient
+		bool applyEnergyLoss=false;
+		bool fixedCM=false; //parent invariant mass, and so the CM energy and momentum of the ejectile, are the same for every event
+		bool fixedAllowed=true; //with fixedCM, whether the kinematics are allowed at all
+		double ejectileE_cm=0.0;
+		double ejectileP_cm=0.0;
 	};
 
 	class Reactor
@@ -40,8 +51,6 @@ namespace NucKage {
 		~Reactor();
 
 		inline const Type GetType() const { return m_type; }
-		inline void SetTarget4Vector(const TLorentzVector& vec) { if(m_reactants.size() > 0) m_reactants[0].pvector = vec; }
-		inline void ResetTarget4Vector() { if(m_reactants.size() > 0) m_reactants[0].pvector.SetPxPyPzE(0.,0.,0.,m_reactants[0].mass); }
 		inline const Nucleus& GetTarget() const { if(m_reactants.size() > 0) return m_reactants[0]; else return m_blank;}
 		inline const Nucleus& GetResidual() const 
 		{ 
@@ -58,19 +67,65 @@ namespace NucKage {
 		}
 		const std::string GetEquation() const;
 
-		ReactorProducts GenerateProducts(const ReactionParameters& params);
+		//Batch interface: the sampled parameters and target four-vectors are already in columns, the products are written to columns
+		void SetupColumns(ReactorColumns& columns) const;
+		void GenerateBatch(ReactorColumns& columns, const std::vector<double>& targetFraction, size_t n);
+		//GenerateBatch for a reactor whose type is known at compile time (see ReactorChain::GenerateBatch)
+		template<Type T>
+		void GenerateBatchAs(ReactorColumns& columns, const std::vector<double>& targetFraction, size_t n)
+		{
+			s_nBatchEvents.fetch_add(n, std::memory_order_relaxed);
+			if constexpr(T == Type::Reaction)
+			{
+				if(m_plan.fixedCM)
+					s_nFastPathEvents.fetch_add(n, std::memory_order_relaxed);
+				CalculateReactionBatch(columns, targetFraction, n);
+			}
+			else if constexpr(T == Type::Decay)
+			{
+				if(m_plan.fixedCM)
+					s_nFastPathEvents.fetch_add(n, std::memory_order_relaxed);
+				CalculateDecayBatch(columns, targetFraction, n);
+			}
+			else
+			{
+				for(size_t i=0; i<n; i++)
+					columns.valid[i] = 0;
+			}
+		}
 
-		inline void BindTarget(Target* target) { m_target = target; }
+		void BindTarget(Target* target);
+		void CompilePlan(const PlanConditions& conditions);
+		inline const ReactorPlan& GetPlan() const { return m_plan; }
+
+		//Events generated through GenerateBatch, and how many of those took the fixed-CM fast path, over all reactors
+		inline static uint64_t GetNumberOfBatchEvents() { return s_nBatchEvents; }
+		inline static uint64_t GetNumberOfFastPathEvents() { return s_nFastPathEvents; }
 
 	private:
-		ReactorProducts CalculateReaction(const ReactionParameters& params);
-		ReactorProducts CalculateDecay(const ReactionParameters& params);
+		void CalculateReactionBatch(ReactorColumns& columns, const std::vector<double>& targetFraction, size_t n);
+		void CalculateDecayBatch(ReactorColumns& columns, const std::vector<double>& targetFraction, size_t n);
+		void ApplyEjectileEnergyLossBatch(ParticleColumns& ejectile, const std::vector<uint8_t>& valid, const std::vector<double>& targetFraction,
+										  size_t n);
 
 		Type m_type;
 		std::vector<Nucleus> m_reactants;
 		Target* m_target; //Not owned by reactor! do not delete
+		Target::ProjectileHandle m_beamHandle; //species sent through the target, registered by BindTarget
+		Target::ProjectileHandle m_ejectileHandle;
+
+		NameID m_equation; //interned when the reactor is built
+		ReactorPlan m_plan;
 
 		Nucleus m_blank;
+
+		//Scratch columns for the batch energy loss
+		std::vector<double> m_energyLossKE;
+		std::vector<double> m_energyLossTheta;
+		std::vector<double> m_energyLoss;
+
+		inline static std::atomic<uint64_t> s_nBatchEvents = 0;
+		inline static std::atomic<uint64_t> s_nFastPathEvents = 0;
 	};
 }
 
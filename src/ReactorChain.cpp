@@ -1,24 +1,39 @@
 #include "ReactorChain.h"
 #include <iostream>
+#include <algorithm>
 
 namespace NucKage {
 
 	int ReactorChain::s_globalChainID = 0;
-	ReactorChain::ReactorChain() :
-		m_thetaDist(-1.0, 1.0), m_phiDist(0.0, 2.0*M_PI), m_targetDist(0.0, 1.0)
+	ReactorChain::ReactorChain()
 	{
 		++s_globalChainID;
-		m_result.chainID = s_globalChainID;
+		m_chainID = s_globalChainID;
+	}
+
+	//Copies keep the chain ID, and the reactors are rebound to the copy's own target
+	ReactorChain::ReactorChain(const ReactorChain& other) :
+		m_reactors(other.m_reactors), m_chainID(other.m_chainID), m_target(other.m_target), m_sampling(other.m_sampling)
+	{
+		BindTarget();
 	}
 
 	ReactorChain::~ReactorChain() {}
 
+	ReactorChain& ReactorChain::operator=(const ReactorChain& other)
+	{
+		m_reactors = other.m_reactors;
+		m_chainID = other.m_chainID;
+		m_target = other.m_target;
+		m_sampling = other.m_sampling;
+		BindTarget();
+		return *this;
+	}
+
 	void ReactorChain::AddReactor(const std::vector<int>& Z, const std::vector<int>& A, const SamplingParameters& params)
 	{
 		m_reactors.emplace_back(Z, A);
-		m_result.products.push_back(ReactorProducts());
-		m_beamDists.emplace_back(params.meanBeamKE, params.sigmaBeamKE);
-		m_exDists.emplace_back(params.meanEx, params.sigmaEx);
+		m_sampling.push_back(params);
 	}
 
 	void ReactorChain::SetTarget(const std::vector<int>& ZT, const std::vector<int>& stoich, double thickness)
@@ -27,10 +42,64 @@ namespace NucKage {
 		BindTarget();
 	}
 
+	//Another layer of the target, downstream of the ones already set
+	void ReactorChain::AddTargetLayer(const std::vector<int>& ZT, const std::vector<int>& stoich, double thickness)
+	{
+		m_target.AddLayer(ZT, stoich, thickness);
+		BindTarget();
+	}
+
+	/*
+		The reactions happen in the first layer of the target which contains the target nucleus of the first reactor (the
+		first layer if none does), and the reactors tabulate their species in every layer
+	*/
 	void ReactorChain::BindTarget()
 	{
+		if(m_reactors.size() > 0)
+		{
+			int layer = m_target.FindLayer(m_reactors[0].GetTarget().Z);
+			m_target.SetReactionLayer(layer < 0 ? 0 : layer);
+		}
 		for(auto& reactor : m_reactors)
 			reactor.BindTarget(&m_target);
+		CompilePlans();
+	}
+
+	/*
+		Walk the chain and tell each reactor what will be the same for every event: the first target is at rest in its ground
+		state, a parent has a fixed mass if the residual it comes from has no excitation spread (decay residuals are always
+		left in their ground state).
+	*/
+	void ReactorChain::CompilePlans()
+	{
+		if(m_reactors.empty())
+			return;
+
+		PlanConditions conditions;
+		conditions.targetAtRest = true;
+		conditions.fixedTargetMass = true;
+		conditions.targetMass = m_reactors[0].GetTarget().mass;
+		for(size_t i=0; i<m_reactors.size(); i++)
+		{
+			const SamplingParameters& sampling = m_sampling[i];
+			conditions.fixedBeamEnergy = sampling.sigmaBeamKE == 0.0;
+			conditions.beamEnergy = sampling.meanBeamKE;
+			conditions.fixedExcitation = sampling.sigmaEx == 0.0;
+			conditions.excitation = sampling.meanEx;
+			m_reactors[i].CompilePlan(conditions);
+
+			conditions.targetAtRest = false;
+			if(m_reactors[i].GetType() == Reactor::Type::Reaction)
+			{
+				conditions.fixedTargetMass = conditions.fixedExcitation;
+				conditions.targetMass = m_reactors[i].GetResidual().mass + conditions.excitation;
+			}
+			else
+			{
+				conditions.fixedTargetMass = true;
+				conditions.targetMass = m_reactors[i].GetResidual().mass;
+			}
+		}
 	}
 
 	bool ReactorChain::VerifyChain()
@@ -57,41 +126,74 @@ namespace NucKage {
 		return result;
 	}
 
-	//assumes all steps short enough that occur at roughly same reaction location
-	ChainResult& ReactorChain::GenerateProducts()
+	void ReactorChain::BeginBatch(size_t n, EventBlock& block)
 	{
-		ReactionParameters params;
 		RandomGenerator& generator = RandomGenerator::GetInstance();
-		params.targetFraction = m_targetDist(generator.GetGenerator()); //determine location of rxn
+		block.chainID = m_chainID;
+		block.Resize(m_reactors.size(), n);
+		for(size_t j=0; j<n; j++)
+			block.targetFraction[j] = generator.Uniform(); //determine location of rxn
+	}
+
+	//Sample the parameters of reactor index, set up its target columns and run its kinematics over the block
+	template<Reactor::Type T>
+	void ReactorChain::GenerateStage(size_t index, size_t n, EventBlock& block)
+	{
+		RandomGenerator& generator = RandomGenerator::GetInstance();
+		ReactorColumns& columns = block.reactors[index];
+		const SamplingParameters& sampling = m_sampling[index];
+		m_reactors[index].SetupColumns(columns);
+
+		if constexpr(T == Reactor::Type::Reaction)
+		{
+			for(size_t j=0; j<n; j++)
+				columns.beamEnergy[j] = sampling.meanBeamKE + sampling.sigmaBeamKE*generator.Normal();
+		}
+		for(size_t j=0; j<n; j++)
+			columns.excitation[j] = sampling.meanEx + sampling.sigmaEx*generator.Normal();
+		for(size_t j=0; j<n; j++)
+			generator.IsotropicDirection(columns.directionX[j], columns.directionY[j], columns.directionZ[j]);
+
+		ParticleColumns& target = columns.particles[ReactorColumns::Target];
+		if(index == 0)
+		{
+			double mass = m_reactors[index].GetTarget().mass;
+			for(size_t j=0; j<n; j++)
+			{
+				target.px[j] = 0.0;
+				target.py[j] = 0.0;
+				target.pz[j] = 0.0;
+				target.E[j] = mass;
+				columns.valid[j] = 1;
+			}
+		}
+		else
+		{
+			const ReactorColumns& previous = block.reactors[index-1];
+			const ParticleColumns& residual = previous.particles[ReactorColumns::Residual];
+			std::copy(residual.px.begin(), residual.px.begin() + n, target.px.begin());
+			std::copy(residual.py.begin(), residual.py.begin() + n, target.py.begin());
+			std::copy(residual.pz.begin(), residual.pz.begin() + n, target.pz.begin());
+			std::copy(residual.E.begin(), residual.E.begin() + n, target.E.begin());
+			std::copy(previous.valid.begin(), previous.valid.begin() + n, columns.valid.begin());
+		}
+
+		m_reactors[index].GenerateBatchAs<T>(columns, block.targetFraction, n);
+	}
+
+	//n events written to the columns of block, one reactor (and one stage) at a time. The type of each reactor is checked
+	//once per block.
+	void ReactorChain::GenerateBatch(size_t n, EventBlock& block)
+	{
+		BeginBatch(n, block);
 		for(size_t i=0; i<m_reactors.size(); i++)
 		{
-			i != 0 ? m_reactors[i].SetTarget4Vector(m_reactors[i-1].GetResidual().pvector) : void();
 			switch(m_reactors[i].GetType())
 			{
-				case Reactor::Type::Reaction:
-				{
-					params.beamEnergy = m_beamDists[i](generator.GetGenerator());
-					params.excitationEnergy = m_exDists[i](generator.GetGenerator());
-					params.thetaCM = std::acos(m_thetaDist(generator.GetGenerator()));
-					params.phiCM = m_phiDist(generator.GetGenerator());
-					break;
-				}
-				case Reactor::Type::Decay:
-				{
-					params.excitationEnergy = m_exDists[i](generator.GetGenerator());
-					params.thetaCM = std::acos(m_thetaDist(generator.GetGenerator()));
-					params.phiCM = m_phiDist(generator.GetGenerator());
-					break;
-				}
-				case Reactor::Type::None:
-				{
-					std::cerr<<"ERR -- Reactor of None type encountered in ReactorChain::GenerateProducts()"<<std::endl;
-					return m_result;
-				}
+				case Reactor::Type::Reaction: GenerateStage<Reactor::Type::Reaction>(i, n, block); break;
+				case Reactor::Type::Decay: GenerateStage<Reactor::Type::Decay>(i, n, block); break;
+				case Reactor::Type::None: GenerateStage<Reactor::Type::None>(i, n, block); break;
 			}
-			m_result.products[i] = m_reactors[i].GenerateProducts(params);
 		}
-
-		return m_result;
 	}
 }
\ No newline at end of file
@@ -15,36 +15,34 @@ namespace NucKage {
 		double sigmaEx=0.0;
 	};
 
-	struct ChainResult
-	{
-		int chainID=-1;
-		std::vector<ReactorProducts> products;
-	};
-
 	class ReactorChain
 	{
 	public:
 		ReactorChain();
+		ReactorChain(const ReactorChain& other);
 		~ReactorChain();
+
+		ReactorChain& operator=(const ReactorChain& other);
 		void AddReactor(const std::vector<int>& Z, const std::vector<int>& A, const SamplingParameters& params);
 		void SetTarget(const std::vector<int>& ZT, const std::vector<int>& stoich, double thickness);
+		void AddTargetLayer(const std::vector<int>& ZT, const std::vector<int>& stoich, double thickness);
 		void BindTarget();
 		bool VerifyChain();
-		inline const int GetChainID() const { return m_result.chainID; }
-		ChainResult& GenerateProducts();
+		inline const int GetChainID() const { return m_chainID; }
+		void GenerateBatch(size_t n, EventBlock& block);
 
 	private:
+		void CompilePlans();
+		void BeginBatch(size_t n, EventBlock& block);
+		template<Reactor::Type T>
+		void GenerateStage(size_t index, size_t n, EventBlock& block);
+
 		static int s_globalChainID;
 		std::vector<Reactor> m_reactors;
-		ChainResult m_result;
+		int m_chainID;
 		Target m_target;
 
-		std::uniform_real_distribution<double> m_thetaDist;
-		std::uniform_real_distribution<double> m_phiDist;
-		std::uniform_real_distribution<double> m_targetDist;
-
-		std::vector<std::normal_distribution<double>> m_beamDists;
-		std::vector<std::normal_distribution<double>> m_exDists;
+		std::vector<SamplingParameters> m_sampling;
 	};
 }
 
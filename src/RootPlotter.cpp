@@ -1,18 +1,16 @@
 #include "RootPlotter.h"
-#include <TH2.h>
 #include <TH1.h>
-#include <TGraph.h>
 
 namespace NucKage {
 
 	RootPlotter::RootPlotter() :
-		m_queueSize(0)
+		m_openFlag(false), m_nMerged(0), m_pendingBytes(0), m_peakPendingBytes(0), m_mergedBytes(0), m_ringBytes(0), m_file(nullptr)
 	{
 		TH1::AddDirectory(kFALSE);
 	}
 
 	RootPlotter::RootPlotter(const std::string& name) :
-		m_queueSize(0)
+		m_openFlag(false), m_nMerged(0), m_pendingBytes(0), m_peakPendingBytes(0), m_mergedBytes(0), m_ringBytes(0), m_file(nullptr)
 	{
 		TH1::AddDirectory(kFALSE);
 		Open(name);
@@ -35,204 +33,97 @@ namespace NucKage {
 			m_openFlag = false;
 	}
 
-	void RootPlotter::Close()
+	void RootPlotter::Reset(int nproducers)
 	{
-		std::lock_guard<std::mutex> guard(m_rootMutex);
-		for(auto& iter : m_map)
-			iter.second->Write();
-		m_file->Close();
-		m_openFlag = false;
+		m_merged = PlotSet();
+		m_pending.clear();
+		m_rings.clear();
+		for(int i=0; i<nproducers; i++)
+			m_rings.push_back(std::make_unique<SetRing>());
+		m_nMerged = 0;
+		m_pendingBytes = 0;
+		m_peakPendingBytes = 0;
+		m_mergedBytes = 0;
+		m_ringBytes = 0;
 	}
 
-	void RootPlotter::MyFill2D(const Histo2DParams& params, double valueX, double valueY)
+	//Called once per chunk. The consumer drains the rings after every finished job, so a full ring only ever waits briefly
+	void RootPlotter::SubmitSet(int producer, uint64_t index, PlotSet& set)
 	{
-		auto h = std::static_pointer_cast<TH2>(m_map[params.name]);
-		if(h) {
-			h->Fill(valueX, valueY);
-		} else {
-			h = std::make_shared<TH2F>(params.name.c_str(), params.name.c_str(), params.binsX, params.minX, params.maxX, params.binsY, params.minY, params.maxY);
-			h->Fill(valueX, valueY);
-			m_map[params.name] = h;
-		}
-	}
+		FinishedSet finished;
+		finished.index = index;
+		finished.set.Merge(set);
+		m_ringBytes += finished.set.GetSizeBytes();
+		if(m_rings[producer]->TryPush(std::move(finished)))
+			return;
 
-	void RootPlotter::MyFill1D(const Histo1DParams& params, double valueX)
-	{
-		auto h = std::static_pointer_cast<TH1>(m_map[params.name]);
-		if(h) {
-			h->Fill(valueX);
-		} else {
-			h = std::make_shared<TH1F>(params.name.c_str(), params.name.c_str(), params.binsX, params.minX, params.maxX);
-			h->Fill(valueX);
-			m_map[params.name] = h;
-		}
+		std::unique_lock<std::mutex> guard(m_ringMutex);
+		m_ringCondition.wait(guard, [&]() {
+			return m_rings[producer]->TryPush(std::move(finished));
+		});
 	}
 
-	void RootPlotter::MyFillGraph(const std::string& name, double valueX, double valueY, int color)
+	void RootPlotter::CollectSets()
 	{
-		auto g = std::static_pointer_cast<TGraph>(m_map[name]);
-		if(g)
-		{
-			g->SetPoint(g->GetN(), valueX, valueY);
-		}
-		else
+		FinishedSet finished;
+		bool popped = false;
+		for(auto& ring : m_rings)
 		{
-			g = std::make_shared<TGraph>(1, &valueX, &valueY);
-			g->SetName(name.c_str());
-			g->SetTitle(name.c_str());
-			g->SetMarkerColor(color);
-			m_map[name] = g;
-		}
-		
-	}
-
-
-	void RootPlotter::PlotData()
-	{
-		if(!IsOpen() || m_queueSize == 0)
-			return;
-
-		ChainResult data = PopData();
-		Histo1DParams h1pars;
-		std::string graph_name;
-		for(auto& result : data.products)
-		{
-			graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.target.symbol+"_KEvTheta;#theta_{Lab}(deg);KE (MeV)";
-			MyFillGraph(graph_name, result.target.pvector.Theta()*s_rad2deg, result.target.pvector.E()-result.target.pvector.M(), 2);
-			graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.target.symbol+"_KEvPhi;#phi_{Lab}(deg);KE (MeV)";
-			MyFillGraph(graph_name, FullPhi(result.target.pvector.Phi())*s_rad2deg, result.target.pvector.E()-result.target.pvector.M(), 2);
-			h1pars.name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.target.symbol+"_Ex;E_{x} (MeV);counts";
-			h1pars.binsX = 300, h1pars.minX = 0.0, h1pars.maxX = 30.0;
-			MyFill1D(h1pars, result.target.pvector.M()-result.target.mass);
-
-			graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.ejectile.symbol+"_KEvTheta;#theta_{Lab}(deg);KE (MeV)";
-			MyFillGraph(graph_name, result.ejectile.pvector.Theta()*s_rad2deg, result.ejectile.pvector.E()-result.ejectile.pvector.M(), 4);
-			graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.ejectile.symbol+"_KEvPhi;#phi_{Lab}(deg);KE (MeV)";
-			MyFillGraph(graph_name, FullPhi(result.ejectile.pvector.Phi())*s_rad2deg, result.ejectile.pvector.E()-result.ejectile.pvector.M(), 4);
-			
-			graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.residual.symbol+"_KEvTheta;#theta_{Lab}(deg);KE (MeV)";
-			MyFillGraph(graph_name, result.residual.pvector.Theta()*s_rad2deg, result.residual.pvector.E()-result.residual.pvector.M(), 5);
-			graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.residual.symbol+"_KEvPhi;#phi_{Lab}(deg);KE (MeV)";
-			MyFillGraph(graph_name, FullPhi(result.residual.pvector.Phi())*s_rad2deg, result.residual.pvector.E()-result.residual.pvector.M(), 5);
-			h1pars.name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.residual.symbol+"_Ex;E_{x} (MeV);counts";
-			h1pars.binsX = 300, h1pars.minX = 0.0, h1pars.maxX = 30.0;
-			MyFill1D(h1pars, result.residual.pvector.M()-result.residual.mass);
-
-			if(!result.projectile.symbol.empty())
+			while(ring->TryPop(finished))
 			{
-				graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.projectile.symbol+"_KEvTheta;#theta_{Lab}(deg);KE (MeV)";
-				MyFillGraph(graph_name, result.projectile.pvector.Theta()*s_rad2deg, result.projectile.pvector.E()-result.projectile.pvector.M(), 3);
-				graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.projectile.symbol+"_KEvPhi;#phi_{Lab}(deg);KE (MeV)";
-				MyFillGraph(graph_name, FullPhi(result.projectile.pvector.Phi())*s_rad2deg, result.projectile.pvector.E()-result.projectile.pvector.M(), 3);
-				h1pars.name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.projectile.symbol+"_KE;KE (MeV);counts";
-				h1pars.binsX = 300, h1pars.minX = 0.0, h1pars.maxX = 30.0;
-				MyFill1D(h1pars, result.projectile.pvector.E()-result.projectile.pvector.M());
-			}
-
-			if(result.ejectile.detected)
-			{
-				graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.ejectile.symbol+"_KEvTheta_detect;#theta_{Lab}(deg);KE (MeV)";
-				MyFillGraph(graph_name, result.ejectile.pvector.Theta()*s_rad2deg, result.ejectile.pvector.E()-result.ejectile.pvector.M(), 4);
-				graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.ejectile.symbol+"_KEvPhi_detect;#phi_{Lab}(deg);KE (MeV)";
-				MyFillGraph(graph_name, FullPhi(result.ejectile.pvector.Phi())*s_rad2deg, result.ejectile.pvector.E()-result.ejectile.pvector.M(), 4);
-				if(result.ejectile.detectorName == "FocalPlane")
-				{
-					h1pars.name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.ejectile.symbol+"_rho;#rho (cm);counts";
-					h1pars.binsX = 1400, h1pars.minX = 69.5, h1pars.maxX = 83.5;
-					MyFill1D(h1pars, result.ejectile.rho);
-				}
+				m_ringBytes -= finished.set.GetSizeBytes();
+				MergeInOrder(finished.index, finished.set);
+				popped = true;
 			}
+		}
 
-			if(result.residual.detected)
+		//Taking the lock orders the pops before a producer's check of its ring, so the wake up cannot be missed
+		if(popped)
+		{
 			{
-				graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.residual.symbol+"_KEvTheta_detect;#theta_{Lab}(deg);KE (MeV)";
-				MyFillGraph(graph_name, result.residual.pvector.Theta()*s_rad2deg, result.residual.pvector.E()-result.residual.pvector.M(), 4);
-				graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.residual.symbol+"_KEvPhi_detect;#phi_{Lab}(deg);KE (MeV)";
-				MyFillGraph(graph_name, FullPhi(result.residual.pvector.Phi())*s_rad2deg, result.residual.pvector.E()-result.residual.pvector.M(), 4);
-				if(result.residual.detectorName == "FocalPlane")
-				{
-					h1pars.name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.residual.symbol+"_rho;#rho (cm);counts";
-					h1pars.binsX = 1400, h1pars.minX = 69.5, h1pars.maxX = 83.5;
-					MyFill1D(h1pars, result.residual.rho);
-				}
+				std::unique_lock<std::mutex> guard(m_ringMutex);
 			}
-			
+			m_ringCondition.notify_all();
 		}
-		m_queueSize--;
 	}
 
-	//Testing single thread only! Not thread safe
-	void RootPlotter::PlotData(const ChainResult& data)
+	void RootPlotter::MergeInOrder(uint64_t index, PlotSet& set)
 	{
-		if(!IsOpen())
+		if(index != m_nMerged)
+		{
+			uint64_t bytes = set.GetSizeBytes();
+			m_pending[index].Merge(set);
+			m_pendingBytes += bytes;
+			if(m_pendingBytes > m_peakPendingBytes)
+				m_peakPendingBytes = m_pendingBytes;
 			return;
+		}
 
-		Histo1DParams h1pars;
-		std::string graph_name;
-		for(auto& result : data.products)
+		m_merged.Merge(set);
+		m_nMerged++;
+		//Drain anything that was waiting on this chunk
+		auto iter = m_pending.begin();
+		while(iter != m_pending.end() && iter->first == m_nMerged)
 		{
-
-			graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.target.symbol+"_KEvTheta;#theta_{Lab}(deg);KE (MeV)";
-			MyFillGraph(graph_name, result.target.pvector.Theta()*s_rad2deg, result.target.pvector.E()-result.target.pvector.M(), 2);
-			graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.target.symbol+"_KEvPhi;#phi_{Lab}(deg);KE (MeV)";
-			MyFillGraph(graph_name, FullPhi(result.target.pvector.Phi())*s_rad2deg, result.target.pvector.E()-result.target.pvector.M(), 2);
-			h1pars.name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.target.symbol+"_Ex;E_{x} (MeV);counts";
-			h1pars.binsX = 300, h1pars.minX = 0.0, h1pars.maxX = 30.0;
-			MyFill1D(h1pars, result.target.pvector.M()-result.target.mass);
-
-			
-			graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.ejectile.symbol+"_KEvTheta;#theta_{Lab}(deg);KE (MeV)";
-			MyFillGraph(graph_name, result.ejectile.pvector.Theta()*s_rad2deg, result.ejectile.pvector.E()-result.ejectile.pvector.M(), 4);
-			graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.ejectile.symbol+"_KEvPhi;#phi_{Lab}(deg);KE (MeV)";
-			MyFillGraph(graph_name, FullPhi(result.ejectile.pvector.Phi())*s_rad2deg, result.ejectile.pvector.E()-result.ejectile.pvector.M(), 4);
-			
-			graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.residual.symbol+"_KEvTheta;#theta_{Lab}(deg);KE (MeV)";
-			MyFillGraph(graph_name, result.residual.pvector.Theta()*s_rad2deg, result.residual.pvector.E()-result.residual.pvector.M(), 5);
-			graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.residual.symbol+"_KEvPhi;#phi_{Lab}(deg);KE (MeV)";
-			MyFillGraph(graph_name, FullPhi(result.residual.pvector.Phi())*s_rad2deg, result.residual.pvector.E()-result.residual.pvector.M(), 5);
-			h1pars.name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.residual.symbol+"_Ex;E_{x} (MeV);counts";
-			h1pars.binsX = 300, h1pars.minX = 0.0, h1pars.maxX = 30.0;
-			MyFill1D(h1pars, result.residual.pvector.M()-result.residual.mass);
-
-			if(!result.projectile.symbol.empty())
-			{
-				graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.projectile.symbol+"_KEvTheta;#theta_{Lab}(deg);KE (MeV)";
-				MyFillGraph(graph_name, result.projectile.pvector.Theta()*s_rad2deg, result.projectile.pvector.E()-result.projectile.pvector.M(), 3);
-				graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.projectile.symbol+"_KEvPhi;#phi_{Lab}(deg);KE (MeV)";
-				MyFillGraph(graph_name, FullPhi(result.projectile.pvector.Phi())*s_rad2deg, result.projectile.pvector.E()-result.projectile.pvector.M(), 3);
-				h1pars.name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.projectile.symbol+"_KE;KE (MeV);counts";
-				h1pars.binsX = 300, h1pars.minX = 0.0, h1pars.maxX = 30.0;
-				MyFill1D(h1pars, result.projectile.pvector.E()-result.projectile.pvector.M());
-			}
-
-			if(result.ejectile.detected)
-			{
-				graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.ejectile.symbol+"_KEvTheta_detect;#theta_{Lab}(deg);KE (MeV)";
-				MyFillGraph(graph_name, result.ejectile.pvector.Theta()*s_rad2deg, result.ejectile.pvector.E()-result.ejectile.pvector.M(), 4);
-				graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.ejectile.symbol+"_KEvPhi_detect;#phi_{Lab}(deg);KE (MeV)";
-				MyFillGraph(graph_name, FullPhi(result.ejectile.pvector.Phi())*s_rad2deg, result.ejectile.pvector.E()-result.ejectile.pvector.M(), 4);
-				if(result.ejectile.detectorName == "FocalPlane")
-				{
-					h1pars.name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.ejectile.symbol+"_rho;#rho (cm);counts";
-					h1pars.binsX = 1400, h1pars.minX = 69.5, h1pars.maxX = 83.5;
-					MyFill1D(h1pars, result.ejectile.rho);
-				}
-			}
-
-			if(result.residual.detected)
-			{
-				graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.residual.symbol+"_KEvTheta_detect;#theta_{Lab}(deg);KE (MeV)";
-				MyFillGraph(graph_name, result.residual.pvector.Theta()*s_rad2deg, result.residual.pvector.E()-result.residual.pvector.M(), 4);
-				graph_name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.residual.symbol+"_KEvPhi_detect;#phi_{Lab}(deg);KE (MeV)";
-				MyFillGraph(graph_name, FullPhi(result.residual.pvector.Phi())*s_rad2deg, result.residual.pvector.E()-result.residual.pvector.M(), 4);
-				if(result.residual.detectorName == "FocalPlane")
-				{
-					h1pars.name = "Chain_"+std::to_string(data.chainID)+"_Rxn_"+result.reactorName+"_Nuc_"+result.residual.symbol+"_rho;#rho (cm);counts";
-					h1pars.binsX = 1400, h1pars.minX = 69.5, h1pars.maxX = 83.5;
-					MyFill1D(h1pars, result.residual.rho);
-				}
-			}
-			
+			m_pendingBytes -= iter->second.GetSizeBytes();
+			m_merged.Merge(iter->second);
+			m_nMerged++;
+			iter = m_pending.erase(iter);
 		}
+		m_mergedBytes = m_merged.GetSizeBytes();
+	}
+
+	void RootPlotter::Close()
+	{
+		CollectSets();
+		for(auto& iter : m_pending)
+			m_merged.Merge(iter.second);
+		m_pending.clear();
+		m_pendingBytes = 0;
+		m_merged.Write();
+		m_merged = PlotSet();
+		m_mergedBytes = 0;
+		m_file->Close();
+		m_openFlag = false;
 	}
-}
\ No newline at end of file
+}
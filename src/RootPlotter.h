@@ -2,17 +2,26 @@
 #define ROOT_PLOTTER_H
 
 #include <string>
+#include <map>
 #include <vector>
-#include "ReactorChain.h"
+#include <memory>
+#include "PlotSet.h"
+#include "Utils/SPSCRing.h"
 #include <TFile.h>
-#include <unordered_map>
-#include <mutex>
 #include <atomic>
-#include <queue>
-#include <memory>
+#include <mutex>
+#include <condition_variable>
 
 namespace NucKage {
 
+	/*
+		Owns the output file. Workers never plot through the RootPlotter directly; each chunk of samples fills
+		its own PlotSet and publishes it once the chunk is done. Every worker owns a lock-free single-producer
+		ring, and the main thread is the only consumer: CollectSets() round-robins over the rings and merges the
+		sets in chunk order, so no lock is shared between workers and the output does not depend on which worker
+		ran which chunk. Sets that arrive early are held as pending until their turn; the Simulator uses the
+		size of everything it holds (merged, pending, and still in the rings) for back-pressure. A producer whose ring is full sleeps until the consumer has drained it.
+	*/
 	class RootPlotter
 	{
 	public:
@@ -20,66 +29,42 @@ namespace NucKage {
 		RootPlotter(const std::string& name);
 		~RootPlotter();
 		inline bool IsOpen() { return m_openFlag; }
-		inline void PushData(const ChainResult& data)
-		{
-			std::lock_guard<std::mutex> guard(m_rootMutex);
-			m_queue.push(data);
-			m_queueSize++;
-		}
-
-		inline uint64_t GetQueueSize()
-		{
-			return m_queueSize;
-		}
-		void PlotData();//const ChainResult& data);
-		void PlotData(const ChainResult& data); //For single thread testing
+		inline uint64_t GetNumberMerged() const { return m_nMerged; }
+		inline uint64_t GetPendingBytes() const { return m_pendingBytes; }
+		inline uint64_t GetPeakPendingBytes() const { return m_peakPendingBytes; }
+		//Plot memory held for the output: the merged set, the pending sets, and the sets published but not yet collected
+		inline uint64_t GetHeldBytes() const { return m_mergedBytes + m_pendingBytes + m_ringBytes; }
+		void Reset(int nproducers);
+		void SubmitSet(int producer, uint64_t index, PlotSet& set); //producer side, one thread per producer index
+		void CollectSets(); //consumer side, main thread only
 		void Close();
 		void Open(const std::string& name);
 
 	private:
-		static constexpr double s_rad2deg = 180.0/M_PI;
-
-		struct Histo2DParams
-		{
-			std::string name;
-			int binsX=0;
-			int binsY=0;
-			double minY=0.0;
-			double minX=0.0;
-			double maxX=0.0;
-			double maxY=0.0;
-		};
-		struct Histo1DParams
+		struct FinishedSet
 		{
-			std::string name;
-			int binsX=0;
-			double minX=0.0;
-			double maxX=0.0;
+			uint64_t index=0;
+			PlotSet set;
 		};
+		using SetRing = SPSCRing<FinishedSet, 8>;
 
-		inline double FullPhi(double phi) { return phi >= 0.0 ? phi : 2.0*M_PI+phi; }
-		inline ChainResult PopData() //Do not decrement queue size here, will cause early exit of program
-		{
-			std::lock_guard<std::mutex> guard(m_rootMutex);
-			auto result = m_queue.front();
-			m_queue.pop();
-			return result;
-		}
-
-		void MyFill2D(const Histo2DParams& params, double valueX, double valueY);
-		void MyFill1D(const Histo1DParams& params, double valueX);
-		void MyFillGraph(const std::string& name, double valueX, double valueY, int color);
+		void MergeInOrder(uint64_t index, PlotSet& set);
 
-		std::queue<ChainResult, std::deque<ChainResult>> m_queue;
+		PlotSet m_merged;
+		std::map<uint64_t, PlotSet> m_pending; //finished out of order, waiting on earlier chunks
+		std::vector<std::unique_ptr<SetRing>> m_rings;
+		std::mutex m_ringMutex; //only taken by a producer with a full ring, and by the consumer to wake it
+		std::condition_variable m_ringCondition;
 
 		std::atomic<bool> m_openFlag;
-		std::atomic<uint64_t> m_queueSize; //Important! Do not use actual queue size, we want to hold off until the data is processed
+		uint64_t m_nMerged;
+		uint64_t m_pendingBytes;
+		uint64_t m_peakPendingBytes;
+		uint64_t m_mergedBytes;
+		std::atomic<uint64_t> m_ringBytes; //added by the producers, taken off by the consumer
 		TFile* m_file;
-		std::unordered_map<std::string, std::shared_ptr<TObject>> m_map;
-
-		std::mutex m_rootMutex;
 	};
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -2,6 +2,8 @@
 #include <iostream>
 #include <fstream>
 #include <future>
+#include <algorithm>
+#include "Utils/MemoryUsage.h"
 
 namespace NucKage {
 
@@ -13,7 +15,8 @@ namespace NucKage {
 	}
 
 	Simulator::Simulator() :
-		m_outputFile(""), m_initFlag(false), m_samples(0), m_pool(1)
+		m_outputFile(""), m_initFlag(false), m_seedFlag(false), m_samples(0), m_samplesDone(0), m_chunkSize(0), m_maxInFlightEvents(0),
+		m_memoryBudget(0), m_peakInFlightChunks(0), m_pool(1)
 	{
 		if(s_instance)
 		{
@@ -25,7 +28,8 @@ namespace NucKage {
 	}
 
 	Simulator::Simulator(int nthreads) :
-		m_outputFile(""), m_initFlag(false), m_samples(0), m_pool(nthreads)
+		m_outputFile(""), m_initFlag(false), m_seedFlag(false), m_samples(0), m_samplesDone(0), m_chunkSize(0), m_maxInFlightEvents(0),
+		m_memoryBudget(0), m_peakInFlightChunks(0), m_pool(nthreads)
 	{
 		if(s_instance)
 		{
@@ -67,6 +71,8 @@ namespace NucKage {
 
 		std::cout<<"Output: "<<m_outputFile<<" samples: "<<m_samples<<std::endl;
 
+		m_seedFlag = false;
+
 		SamplingParameters temp_params;
 		std::vector<int> Z, A, stoich;
 		int a;
@@ -103,26 +109,35 @@ namespace NucKage {
 					}
 					else if(junk == "begin_target")
 					{
-						Z.clear();
-						stoich.clear();
-						input>>thickness;
+						//one or more layers, upstream to downstream: the thickness of the layer followed by its elements
+						bool firstLayer = true;
 						while(input>>junk)
 						{
-							if(junk == "begin_elements")
-								continue;
-							else if(junk == "end_elements")
+							if(junk == "end_target")
 								break;
-							else
+							Z.clear();
+							stoich.clear();
+							thickness = std::stod(junk);
+							while(input>>junk)
 							{
-								Z.push_back(std::stoi(junk));
-								input>>a;
-								stoich.push_back(a);
+								if(junk == "begin_elements")
+									continue;
+								else if(junk == "end_elements")
+									break;
+								else
+								{
+									Z.push_back(std::stoi(junk));
+									input>>a;
+									stoich.push_back(a);
+								}
 							}
+							if(firstLayer)
+								temp_chain.SetTarget(Z, stoich, thickness);
+							else
+								temp_chain.AddTargetLayer(Z, stoich, thickness);
+							firstLayer = false;
 						}
-						temp_chain.SetTarget(Z, stoich, thickness);
 					}
-					else if(junk == "end_target")
-						continue;
 					else if(junk == "end_reactor")
 						continue;
 					else if(junk == "end_reactorchain")
@@ -158,6 +173,65 @@ namespace NucKage {
 					}
 				}
 			}
+			else if(junk == "seed")
+			{
+				input>>temp;
+				RandomGenerator::SetRunSeed(temp);
+				m_seedFlag = true;
+			}
+			else if(junk == "max_inflight_events")
+			{
+				input>>m_maxInFlightEvents;
+			}
+			else if(junk == "memory_budget_mb")
+			{
+				double budget;
+				input>>budget;
+				m_memoryBudget = budget*1.0e6;
+			}
+			else if(junk == "energyloss_integrator")
+			{
+				//euler, or dopri5 followed by the relative energy tolerance
+				input>>junk;
+				if(junk == "euler")
+					EnergyLoss::SetIntegrator(EnergyLoss::Integrator::Euler, EnergyLoss::GetIntegratorTolerance());
+				else if(junk == "dopri5")
+				{
+					double tolerance = 0.0;
+					if(!(input>>tolerance) || !(tolerance > 0.0))
+					{
+						std::cerr<<"Bad input file, dopri5 needs a positive energy loss tolerance in file "<<filename<<std::endl;
+						return;
+					}
+					EnergyLoss::SetIntegrator(EnergyLoss::Integrator::DormandPrince, tolerance);
+				}
+				else
+				{
+					std::cerr<<"Bad input file, unknown energy loss integrator "<<junk<<" in file "<<filename<<std::endl;
+					return;
+				}
+			}
+			else if(junk == "energyloss_cache")
+			{
+				//quantization (relative energy, fraction of the target thickness) of the cached energy losses, 0 is off
+				double quantization;
+				input>>quantization;
+				EnergyLossCache::SetQuantization(quantization);
+			}
+			else if(junk == "energyloss_tables")
+			{
+				//range tables for the species sent through the targets, on by default
+				input>>junk;
+				if(junk == "on")
+					Target::SetUseRangeTables(true);
+				else if(junk == "off")
+					Target::SetUseRangeTables(false);
+				else
+				{
+					std::cerr<<"Bad input file, energyloss_tables must be on or off in file "<<filename<<std::endl;
+					return;
+				}
+			}
 			else if(junk == "end_simulator")
 				break;
 			else
@@ -167,6 +241,16 @@ namespace NucKage {
 			}
 		}
 
+		if(!m_seedFlag)
+			RandomGenerator::SetRunSeed(RandomGenerator::GenerateRunSeed());
+		std::cout<<"Run seed: "<<RandomGenerator::GetRunSeed()<<std::endl;
+		std::cout<<"Energy loss integrator: "<<EnergyLoss::GetIntegratorName(EnergyLoss::GetIntegrator());
+		if(EnergyLoss::GetIntegrator() == EnergyLoss::Integrator::DormandPrince)
+			std::cout<<" tolerance: "<<EnergyLoss::GetIntegratorTolerance();
+		std::cout<<std::endl;
+		if(EnergyLossCache::IsEnabled())
+			std::cout<<"Energy loss cache quantization: "<<EnergyLossCache::GetQuantization()<<std::endl;
+
 		m_initFlag = true;
 
 		input.close();
@@ -187,6 +271,7 @@ namespace NucKage {
 				std::cerr<<"ERR -- Invalid chain with id "<<chain.GetChainID()<<std::endl;
 				return;
 			}
+			//Bound again now that the whole role file is read, so settings such as energyloss_tables apply wherever they appeared
 			chain.BindTarget();
 		}
 
@@ -197,44 +282,134 @@ namespace NucKage {
 			return;
 		}
 
-		for(int i=0; i<m_chains.size(); i++)
-			m_pool.PushJob({std::bind(&Simulator::RunChain, std::ref(*this), std::placeholders::_1), i});
-		while(true)
+		BuildChunks();
+		m_plotter.Reset(m_pool.GetNumberOfWorkers());
+		m_peakInFlightChunks = 0;
+		//Chunks are submitted in order, and only while the in-flight limits allow it. The chunk the plotter is waiting on
+		//has always been submitted already, so holding back later chunks can never stall the run. While waiting the
+		//main thread sleeps until a worker finishes a chunk, then collects the finished plot sets.
+		//The completion count is sampled before collecting, so a set published in between always causes a wake up.
+		//A chunk that throws never publishes its set, so once everything submitted has finished and the limits still
+		//hold the next chunk back, the run stops and the error is reported from the task group.
+		TaskGroup chunks(m_pool);
+		uint64_t ncompletedStart = m_pool.GetNumberCompleted();
+		uint64_t nsubmitted = 0;
+		while(nsubmitted < m_chunks.size())
 		{
-			if(m_pool.IsFinished() && m_plotter.GetQueueSize() == 0)
+			uint64_t ncompleted = m_pool.GetNumberCompleted();
+			m_plotter.CollectSets();
+			if(CanSubmitChunk(nsubmitted))
 			{
-				break;
+				int index = int(nsubmitted);
+				chunks.Run([this, index]() { RunChunk(index); });
+				nsubmitted++;
+				m_peakInFlightChunks = std::max(m_peakInFlightChunks, nsubmitted - m_plotter.GetNumberMerged());
 			}
+			else if(ncompleted - ncompletedStart == nsubmitted)
+				break;
 			else
-				m_plotter.PlotData();
+				m_pool.WaitForCompleted(ncompleted + 1);
+		}
+		while(true)
+		{
+			uint64_t ncompleted = m_pool.GetNumberCompleted();
+			m_plotter.CollectSets();
+			if(ncompleted - ncompletedStart == nsubmitted)
+				break;
+			m_pool.WaitForCompleted(ncompleted + 1);
+		}
+		try
+		{
+			chunks.Wait();
+		}
+		catch(const std::exception& e)
+		{
+			std::cerr<<"ERR -- Simulation stopped, a chunk failed: "<<e.what()<<std::endl;
+			m_pool.Shutdown();
+			return;
 		}
 		std::cout<<std::endl;
 		m_pool.Shutdown();
 		std::cout<<"Thread pool shutdown"<<std::endl;
 		m_plotter.Close();
 		std::cout<<"Data written to file"<<std::endl;
+		std::cout<<"Peak in-flight chunks: "<<m_peakInFlightChunks<<" ("<<m_peakInFlightChunks*m_chunkSize<<" events) pending plot memory: "
+				 <<m_plotter.GetPeakPendingBytes()*1.0e-6<<" MB"<<std::endl;
+		std::cout<<"Peak resident memory: "<<GetPeakResidentBytes()*1.0e-6<<" MB"<<std::endl;
+		uint64_t nreactorEvents = Reactor::GetNumberOfBatchEvents();
+		std::cout<<"Fixed-CM fast path taken for "<<Reactor::GetNumberOfFastPathEvents()<<" of "<<nreactorEvents<<" reactor events"<<std::endl;
+		EnergyLoss::IntegrationStats elossStats = EnergyLoss::GetTotalIntegrationStats();
+		//The thin target share is over every energy loss, whichever way it was answered
+		uint64_t nlosses = elossStats.tableLookups + elossStats.calls;
+		std::cout<<"Energy losses: "<<nlosses<<" (range table: "<<elossStats.tableLookups<<", thin target fast path: "<<elossStats.thinTarget
+				 <<" ("<<(nlosses > 0 ? 100.0*elossStats.thinTarget/nlosses : 0.0)<<"%), integrated: "<<elossStats.calls - elossStats.thinTarget
+				 <<" with "<<elossStats.steps<<" steps, "<<elossStats.rejectedSteps<<" rejected, "<<elossStats.evaluations
+				 <<" stopping power evaluations)"<<std::endl;
+		if(EnergyLossCache::IsEnabled())
+		{
+			EnergyLossCache::Stats cacheStats = EnergyLossCache::GetTotalStats();
+			std::cout<<"Energy loss cache hits: "<<cacheStats.hits<<" misses: "<<cacheStats.misses<<std::endl;
+		}
 	}
 
-	void Simulator::RunChain(int index)
+	//Split every chain into sample ranges so that a single chain can occupy all of the workers
+	void Simulator::BuildChunks()
 	{
-		uint64_t flush_val = m_samples * 0.1;
-		int flush_count = 0;
-		int count=0;
-		std::vector<ChainResult> results;
-		ChainResult this_result;
-		results.reserve(m_samples);
-		for(uint64_t i=0; i<m_samples; i++)
-		{
-			count++;
-			if(count == flush_val)
+		m_chunks.clear();
+		m_samplesDone = 0;
+		m_chunkSize = std::max(s_minChunkSize, (m_samples + s_chunksPerChain - 1)/s_chunksPerChain);
+		for(int i=0; i<m_chains.size(); i++)
+		{
+			for(uint64_t first=0; first<m_samples; first += m_chunkSize)
 			{
-				flush_count++;
-				count = 0;
-				std::cout<<"\rPercent simulated: "<<flush_count*10<<"%"<<std::flush;
+				ChainChunk chunk;
+				chunk.chainIndex = i;
+				chunk.firstSample = first;
+				chunk.nSamples = std::min(m_chunkSize, m_samples - first);
+				m_chunks.push_back(chunk);
 			}
-			this_result = m_chains[index].GenerateProducts();
-			m_array.ProcessData(this_result);
-			m_plotter.PushData(this_result);
 		}
 	}
+
+	//Back-pressure: a chunk is in flight from submission until its plots are merged. At least one chunk is always allowed.
+	bool Simulator::CanSubmitChunk(uint64_t nsubmitted)
+	{
+		uint64_t inflight = nsubmitted - m_plotter.GetNumberMerged();
+		if(inflight == 0)
+			return true;
+		if(m_maxInFlightEvents != 0 && (inflight + 1)*m_chunkSize > m_maxInFlightEvents)
+			return false;
+		if(m_memoryBudget != 0 && m_plotter.GetHeldBytes() > m_memoryBudget)
+			return false;
+		return true;
+	}
+
+	void Simulator::RunChunk(int index)
+	{
+		const ChainChunk& chunk = m_chunks[index];
+		//Each chunk works on its own copy of the chain (reactors, target, result) so that chunks never share mutable state
+		ReactorChain chain = m_chains[chunk.chainIndex];
+		//Random stream depends only on (seed, chain, chunk), never on the worker or the thread count
+		RandomGenerator::GetInstance().SetStream(chain.GetChainID(), chunk.firstSample/m_chunkSize);
+		PlotSet plots;
+		//Events go through each stage (kinematics, detection, plotting) a block at a time
+		EventBlock block;
+		for(uint64_t first=0; first<chunk.nSamples; first += s_batchSize)
+		{
+			size_t n = std::min(s_batchSize, chunk.nSamples - first);
+			chain.GenerateBatch(n, block);
+			m_array.ProcessBatch(block);
+			plots.FillBatch(block);
+		}
+		m_plotter.SubmitSet(ThreadPool::GetWorkerIndex(), index, plots);
+		EnergyLoss::FlushThreadIntegrationStats();
+		EnergyLossCache::FlushThreadStats();
+
+		uint64_t total = m_samples * m_chains.size();
+		uint64_t done = m_samplesDone.fetch_add(chunk.nSamples) + chunk.nSamples;
+		uint64_t prev_percent = (done - chunk.nSamples)*10/total;
+		uint64_t percent = done*10/total;
+		if(percent != prev_percent)
+			std::cout<<"\rPercent simulated: "<<percent*10<<"%"<<std::flush;
+	}
 }
\ No newline at end of file
@@ -23,15 +23,36 @@ namespace NucKage {
 		inline static Simulator& GetInstance() { return *s_instance; }
 
 	private:
-		void RunChain(int index);
+		//A contiguous range of samples from a single chain, the unit of work handed to the thread pool
+		struct ChainChunk
+		{
+			int chainIndex=-1;
+			uint64_t firstSample=0;
+			uint64_t nSamples=0;
+		};
+
+		void BuildChunks();
+		bool CanSubmitChunk(uint64_t nsubmitted);
+		void RunChunk(int index);
 		static Simulator* s_instance;
 
+		//Chunking is fixed by the sample count only, never by the number of threads
+		static constexpr uint64_t s_chunksPerChain = 256;
+		static constexpr uint64_t s_minChunkSize = 1000;
+		static constexpr uint64_t s_batchSize = 1024; //events per EventBlock
+
 		std::string m_outputFile;
 		std::atomic<uint64_t> m_samples;
 		bool m_initFlag;
+		bool m_seedFlag;
 
 		std::vector<ReactorChain> m_chains;
-		std::vector<ChainResult> m_results;
+		std::vector<ChainChunk> m_chunks;
+		std::atomic<uint64_t> m_samplesDone;
+		uint64_t m_chunkSize;
+		uint64_t m_maxInFlightEvents; //0 is unlimited
+		uint64_t m_memoryBudget; //bytes of plots held for the output (merged, pending, collected), 0 is unlimited
+		uint64_t m_peakInFlightChunks;
 		DetectorArray m_array;
 		RootPlotter m_plotter;
 
@@ -1,9 +1,35 @@
 #include <iostream>
 #include "EnergyLoss/Target.h"
+#include "EnergyLoss/StoppingTable.h"
+#include "EnergyLoss/EnergyLossConstants.h"
+#include "MassLookup.h"
 #include <cmath>
+#include <algorithm>
 #include "Utils/Timer.h"
+#include "ThreadPool.h"
+#include "RandomGenerator.h"
+#include "TwoBodyKernel.h"
+#include "TLorentzVector.h"
 
 namespace NucKage {
+	//Target material of a layer with the projectile (Z, A) and no range table, for comparisons with the formulas
+	EnergyLoss::Parameters ProjectileParameters(const Target& target, const std::pair<int, int>& projectile, size_t layer = 0)
+	{
+		EnergyLoss::Parameters params = target.GetParameters(layer);
+		double massP = MassLookup::GetInstance().FindMass(projectile.first, projectile.second)*EnergyLoss::mev2u;
+		EnergyLoss::SetProjectile(params, projectile.first, massP);
+		params.table = nullptr;
+		return params;
+	}
+
+	//Prints the largest relative difference found by a test against its limit
+	bool ReportMaxDifference(const std::string& what, double max_error, double limit)
+	{
+		bool good = max_error < limit;
+		std::cout<<"Max relative difference "<<what<<": "<<max_error<<(good ? " PASS" : " FAIL")<<std::endl;
+		return good;
+	}
+
 	void EnergyLossTest()
 	{
 		Target target;
@@ -57,4 +83,807 @@ namespace NucKage {
 		std::cout<<"------------------------------------------------"<<std::endl;
 	}
 
-}
\ No newline at end of file
+	void ThreadPoolTest()
+	{
+		int nthreads = 4;
+		ThreadPool pool(nthreads);
+		std::cout<<"------------ThreadPool Unit Tests---------------"<<std::endl;
+		std::cout<<"Workers: "<<pool.GetNumberOfWorkers()<<std::endl;
+
+		std::cout<<"Testing Submit futures..."<<std::endl;
+		std::vector<std::future<uint64_t>> futures;
+		for(uint64_t i=0; i<100; i++)
+			futures.push_back(pool.Submit([i]() { return i*i; }));
+		uint64_t sum = 0;
+		for(auto& f : futures)
+			sum += f.get();
+		std::cout<<"Sum of squares 0-99: "<<sum<<" expected: "<<328350<<(sum == 328350 ? " PASS" : " FAIL")<<std::endl;
+
+		std::cout<<"Testing nested task groups..."<<std::endl;
+		std::atomic<uint64_t> count(0);
+		{
+			TaskGroup outer(pool);
+			for(int i=0; i<16; i++)
+			{
+				outer.Run([&pool, &count]() {
+					TaskGroup inner(pool);
+					for(int j=0; j<16; j++)
+						inner.Run([&count]() { count++; });
+					inner.Wait();
+				});
+			}
+			outer.Wait();
+		}
+		std::cout<<"Tasks run: "<<count<<" expected: "<<256<<(count == 256 ? " PASS" : " FAIL")<<std::endl;
+
+		std::cout<<"Testing parallel for..."<<std::endl;
+		std::vector<uint64_t> values(1000003, 0);
+		pool.ParallelFor(0, values.size(), 4096, [&values](uint64_t first, uint64_t last) {
+			for(uint64_t i=first; i<last; i++)
+				values[i] = i;
+		});
+		bool good = true;
+		for(uint64_t i=0; i<values.size(); i++)
+			good &= (values[i] == i);
+		std::cout<<"Parallel for over "<<values.size()<<" elements"<<(good ? " PASS" : " FAIL")<<std::endl;
+
+		pool.Wait();
+		std::cout<<"Pool finished: "<<(pool.IsFinished() ? "PASS" : "FAIL")<<std::endl;
+		std::cout<<"------------------------------------------------"<<std::endl;
+	}
+
+	void RandomGeneratorTest()
+	{
+		std::cout<<"------------RandomGenerator Unit Tests----------"<<std::endl;
+		//Known answers from the Random123 reference implementation
+		Philox4x32::Block zeros = Philox4x32::Generate({0, 0, 0, 0}, {0, 0});
+		Philox4x32::Block ones = Philox4x32::Generate({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff});
+		bool good = zeros == Philox4x32::Block({0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}) &&
+					ones == Philox4x32::Block({0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+		std::cout<<"Philox4x32-10 known answers"<<(good ? " PASS" : " FAIL")<<std::endl;
+
+		std::cout<<"Testing stream reproducibility..."<<std::endl;
+		Philox4x32 first(12345, 1, 7), second(12345, 1, 7), other(12345, 1, 8);
+		std::uniform_real_distribution<double> dist(0.0, 1.0);
+		int nsame = 0, ndifferent = 0;
+		for(int i=0; i<1000; i++)
+		{
+			double value = dist(first);
+			nsame += (value == dist(second));
+			ndifferent += (value != dist(other));
+		}
+		std::cout<<"Identical streams agree on "<<nsame<<"/1000 draws, neighbouring streams differ on "<<ndifferent<<"/1000"
+				 <<(nsame == 1000 && ndifferent == 1000 ? " PASS" : " FAIL")<<std::endl;
+
+		std::cout<<"Testing block-buffered draws..."<<std::endl;
+		RandomGenerator& generator = RandomGenerator::GetInstance();
+		generator.SetStream(1, 0);
+		uint64_t samples = 10000000;
+		double sum = 0.0, sum_sq = 0.0, sum_z = 0.0, max_norm_err = 0.0;
+		double x, y, z;
+		Timer stopwatch("RNGTimer");
+		for(uint64_t i=0; i<samples; i++)
+		{
+			double value = generator.Normal();
+			sum += value;
+			sum_sq += value*value;
+			generator.IsotropicDirection(x, y, z);
+			sum_z += z;
+			max_norm_err = std::max(max_norm_err, std::fabs(x*x + y*y + z*z - 1.0));
+		}
+		float duration = stopwatch.ElapsedMilliseconds();
+		double mean = sum/samples;
+		double variance = sum_sq/samples - mean*mean;
+		good = std::fabs(mean) < 1.0e-3 && std::fabs(variance - 1.0) < 2.0e-3 && std::fabs(sum_z/samples) < 1.0e-3 && max_norm_err < 1.0e-12;
+		std::cout<<"Normal mean: "<<mean<<" variance: "<<variance<<" direction <z>: "<<sum_z/samples<<" max |u|^2-1: "<<max_norm_err
+				 <<(good ? " PASS" : " FAIL")<<std::endl;
+		std::cout<<"Buffered normal + direction pairs: "<<samples<<" in "<<duration<<" ms"<<std::endl;
+
+		std::normal_distribution<double> normal_dist(0.0, 1.0);
+		std::uniform_real_distribution<double> cos_dist(-1.0, 1.0), phi_dist(0.0, 2.0*M_PI);
+		sum = 0.0;
+		stopwatch.Restart();
+		for(uint64_t i=0; i<samples; i++)
+		{
+			sum += normal_dist(generator.GetGenerator());
+			double theta = std::acos(cos_dist(generator.GetGenerator()));
+			double phi = phi_dist(generator.GetGenerator());
+			sum += std::sin(theta)*std::cos(phi) + std::sin(theta)*std::sin(phi) + std::cos(theta);
+		}
+		duration = stopwatch.ElapsedMilliseconds();
+		std::cout<<"std distribution normal + direction pairs: "<<samples<<" in "<<duration<<" ms (checksum "<<sum<<")"<<std::endl;
+		std::cout<<"------------------------------------------------"<<std::endl;
+	}
+
+	void TwoBodyKernelTest()
+	{
+		std::cout<<"------------TwoBodyKernel Unit Tests----------"<<std::endl;
+		std::cout<<"Kernel built with AVX2: "<<(IsTwoBodyKernelVectorized() ? "yes" : "no")<<std::endl;
+		//9B* -> p + 8Be*, odd number of events so the scalar remainder is exercised
+		const double parentMass = 8394.79, ejectMass = 938.272, residMass = 7454.85;
+		const size_t n = 1000003;
+		std::vector<double> parentPx(n), parentPy(n), parentPz(n), parentE(n), excitation(n), dirX(n), dirY(n), dirZ(n);
+		std::vector<double> ejectPx(n), ejectPy(n), ejectPz(n), ejectE(n), residPx(n), residPy(n), residPz(n), residE(n);
+		RandomGenerator& generator = RandomGenerator::GetInstance();
+		generator.SetStream(2, 0);
+		for(size_t i=0; i<n; i++)
+		{
+			double p = 200.0*generator.Uniform();
+			double ux, uy, uz;
+			generator.IsotropicDirection(ux, uy, uz);
+			double mass = parentMass + 2.0 + 2.0*generator.Uniform();
+			parentPx[i] = p*ux, parentPy[i] = p*uy, parentPz[i] = p*uz;
+			parentE[i] = std::sqrt(p*p + mass*mass);
+			excitation[i] = generator.Uniform();
+			generator.IsotropicDirection(dirX[i], dirY[i], dirZ[i]);
+		}
+		//One event at rest to check the zero boost case
+		parentPx[0] = 0.0, parentPy[0] = 0.0, parentPz[0] = 0.0;
+
+		TwoBodyColumns columns;
+		columns.parentPx = parentPx.data(), columns.parentPy = parentPy.data(), columns.parentPz = parentPz.data(), columns.parentE = parentE.data();
+		columns.residualExcitation = excitation.data();
+		columns.directionX = dirX.data(), columns.directionY = dirY.data(), columns.directionZ = dirZ.data();
+		columns.ejectilePx = ejectPx.data(), columns.ejectilePy = ejectPy.data(), columns.ejectilePz = ejectPz.data(), columns.ejectileE = ejectE.data();
+		columns.residualPx = residPx.data(), columns.residualPy = residPy.data(), columns.residualPz = residPz.data(), columns.residualE = residE.data();
+		Timer stopwatch("KernelTimer");
+		CalculateTwoBody(columns, ejectMass, residMass, n);
+		float kernel_duration = stopwatch.ElapsedMilliseconds();
+
+		//Reference: the per-event TLorentzVector path of Reactor::CalculateDecay
+		double max_error = 0.0, checksum = 0.0;
+		TLorentzVector parent, ejectile, residual;
+		stopwatch.Restart();
+		for(size_t i=0; i<n; i++)
+		{
+			parent.SetPxPyPzE(parentPx[i], parentPy[i], parentPz[i], parentE[i]);
+			double residEx = residMass + excitation[i];
+			auto boost = parent.BoostVector();
+			parent.Boost(-1.0*boost);
+			double ejectE_cm = (std::pow(ejectMass, 2.0) - std::pow(residEx, 2.0) + std::pow(parent.E(), 2.0))/(2.0*parent.E());
+			double ejectP_cm = std::sqrt(ejectE_cm*ejectE_cm - std::pow(ejectMass, 2.0));
+			ejectile.SetPxPyPzE(ejectP_cm*dirX[i], ejectP_cm*dirY[i], ejectP_cm*dirZ[i], ejectE_cm);
+			parent.Boost(boost);
+			ejectile.Boost(boost);
+			residual = parent - ejectile;
+			checksum += ejectile.E();
+
+			//Relative to the energy of the particle, components can be arbitrarily close to zero
+			max_error = std::max({max_error,
+								  std::fabs(ejectile.Px() - ejectPx[i])/ejectile.E(), std::fabs(ejectile.Py() - ejectPy[i])/ejectile.E(),
+								  std::fabs(ejectile.Pz() - ejectPz[i])/ejectile.E(), std::fabs(ejectile.E() - ejectE[i])/ejectile.E(),
+								  std::fabs(residual.Px() - residPx[i])/residual.E(), std::fabs(residual.Py() - residPy[i])/residual.E(),
+								  std::fabs(residual.Pz() - residPz[i])/residual.E(), std::fabs(residual.E() - residE[i])/residual.E()});
+		}
+		float reference_duration = stopwatch.ElapsedMilliseconds();
+		ReportMaxDifference("from TLorentzVector path", max_error, 1.0e-12);
+		std::cout<<"Kernel: "<<n<<" events in "<<kernel_duration<<" ms, TLorentzVector: "<<reference_duration<<" ms (checksum "<<checksum<<")"<<std::endl;
+
+		//In-place use (residual written over the parent), as done by Reactor for reactions
+		std::vector<double> inplacePx(parentPx), inplacePy(parentPy), inplacePz(parentPz), inplaceE(parentE);
+		columns.parentPx = inplacePx.data(), columns.parentPy = inplacePy.data(), columns.parentPz = inplacePz.data(), columns.parentE = inplaceE.data();
+		columns.residualPx = inplacePx.data(), columns.residualPy = inplacePy.data(), columns.residualPz = inplacePz.data(), columns.residualE = inplaceE.data();
+		CalculateTwoBody(columns, ejectMass, residMass, n);
+		bool good = inplacePx == residPx && inplacePy == residPy && inplacePz == residPz && inplaceE == residE;
+		std::cout<<"Residual written over parent"<<(good ? " PASS" : " FAIL")<<std::endl;
+
+		//Fixed-CM fast path against the general kernel, for parents which all have the same invariant mass
+		const double fixedMass = parentMass + 3.0;
+		for(size_t i=0; i<n; i++)
+			parentE[i] = std::sqrt(parentPx[i]*parentPx[i] + parentPy[i]*parentPy[i] + parentPz[i]*parentPz[i] + fixedMass*fixedMass);
+		std::vector<double> fixedPx(n), fixedPy(n), fixedPz(n), fixedE(n);
+		columns.parentPx = parentPx.data(), columns.parentPy = parentPy.data(), columns.parentPz = parentPz.data(), columns.parentE = parentE.data();
+		columns.residualExcitation = nullptr;
+		columns.residualPx = residPx.data(), columns.residualPy = residPy.data(), columns.residualPz = residPz.data(), columns.residualE = residE.data();
+		CalculateTwoBody(columns, ejectMass, residMass, n);
+		double ejectE_cm = (ejectMass*ejectMass - residMass*residMass + fixedMass*fixedMass)/(2.0*fixedMass);
+		double ejectP_cm = std::sqrt(ejectE_cm*ejectE_cm - ejectMass*ejectMass);
+		columns.ejectilePx = fixedPx.data(), columns.ejectilePy = fixedPy.data(), columns.ejectilePz = fixedPz.data(), columns.ejectileE = fixedE.data();
+		columns.residualPx = inplacePx.data(), columns.residualPy = inplacePy.data(), columns.residualPz = inplacePz.data(), columns.residualE = inplaceE.data();
+		CalculateTwoBodyFixedCM(columns, ejectE_cm, ejectP_cm, n);
+		max_error = 0.0;
+		for(size_t i=0; i<n; i++)
+		{
+			max_error = std::max({max_error, std::fabs(fixedPx[i] - ejectPx[i])/ejectE[i], std::fabs(fixedPy[i] - ejectPy[i])/ejectE[i],
+								  std::fabs(fixedPz[i] - ejectPz[i])/ejectE[i], std::fabs(fixedE[i] - ejectE[i])/ejectE[i],
+								  std::fabs(inplaceE[i] - residE[i])/residE[i]});
+		}
+		ReportMaxDifference("of the fixed-CM kernel", max_error, 1.0e-12);
+		std::cout<<"------------------------------------------------"<<std::endl;
+	}
+
+	void StoppingTableTest()
+	{
+		std::cout<<"------------StoppingTable Unit Tests------------"<<std::endl;
+		std::vector<std::vector<int>> targetZ = {{6}, {5, 6}, {3, 9}, {79}};
+		std::vector<std::vector<int>> targetS = {{1}, {9, 1}, {1, 1}, {1}};
+		std::vector<std::pair<int, int>> projectiles = {{1, 1}, {1, 2}, {2, 3}, {2, 4}, {3, 7}, {6, 12}};
+		RandomGenerator& generator = RandomGenerator::GetInstance();
+		generator.SetStream(3, 0);
+		const int samples = 100000;
+		double max_error = 0.0, table_sum = 0.0, formula_sum = 0.0;
+		float table_duration = 0.0, formula_duration = 0.0;
+		std::vector<double> energies(samples);
+		for(size_t t=0; t<targetZ.size(); t++)
+		{
+			Target target(targetZ[t], targetS[t], 50.0);
+			for(auto& projectile : projectiles)
+			{
+				EnergyLoss::Parameters params = ProjectileParameters(target, projectile);
+				auto table = StoppingTableRegistry::GetInstance().FindTable(params);
+				//log-uniform over the table range
+				double logRange = std::log(table->GetMaxEnergy()/table->GetMinEnergy());
+				for(auto& energy : energies)
+					energy = table->GetMinEnergy()*std::exp(logRange*generator.Uniform());
+
+				Timer stopwatch("TableTimer");
+				for(auto& energy : energies)
+					table_sum += table->GetStoppingPower(energy);
+				table_duration += stopwatch.ElapsedMilliseconds();
+				stopwatch.Restart();
+				for(auto& energy : energies)
+					formula_sum += EnergyLoss::GetTotalStoppingPower(params, energy);
+				formula_duration += stopwatch.ElapsedMilliseconds();
+
+				for(auto& energy : energies)
+				{
+					double exact = EnergyLoss::GetTotalStoppingPower(params, energy);
+					max_error = std::max(max_error, std::fabs(table->GetStoppingPower(energy) - exact)/exact);
+				}
+			}
+		}
+		std::cout<<"Tables built: "<<StoppingTableRegistry::GetInstance().GetNumberOfTables()<<" with "
+				 <<StoppingTable::s_nodesPerDecade<<" nodes per decade"<<std::endl;
+		ReportMaxDifference("from formulas", max_error, 1.0e-5);
+		std::cout<<"Table: "<<samples*targetZ.size()*projectiles.size()<<" evaluations in "<<table_duration<<" ms, formulas: "
+				 <<formula_duration<<" ms (checksums "<<table_sum<<" "<<formula_sum<<")"<<std::endl;
+
+		//Same target object shared through the registry: a second target with the same composition builds no new table
+		size_t ntables = StoppingTableRegistry::GetInstance().GetNumberOfTables();
+		Target first(targetZ[0], targetS[0], 50.0), second(targetZ[0], targetS[0], 100.0);
+		first.RegisterProjectile(2, 4);
+		second.RegisterProjectile(2, 4);
+		bool good = StoppingTableRegistry::GetInstance().GetNumberOfTables() == ntables;
+		std::cout<<"Tables shared between identical targets"<<(good ? " PASS" : " FAIL")<<std::endl;
+		std::cout<<"------------------------------------------------"<<std::endl;
+	}
+
+	//The electronic stopping power as it was evaluated before the per-element loop was rewritten, kept as a reference
+	double LegacyElectronicStoppingPower(const EnergyLoss::Parameters& params, double current_energy)
+	{
+		current_energy *= 1000.0;
+		double ePerU = current_energy/params.massP;
+		std::vector<double> values;
+		if(ePerU > EnergyLoss::maxHEperU)
+			return 0.0;
+		else if (ePerU > 1000.0)
+		{
+			for(auto& z: params.ZT)
+				values.push_back(EnergyLoss::Hydrogen_dEdx_High(ePerU, params.massP, current_energy, z));
+		}
+		else if (ePerU > 10.0)
+		{
+			for(auto& z: params.ZT)
+				values.push_back(EnergyLoss::Hydrogen_dEdx_Med(ePerU, z));
+		}
+		else if (ePerU > 0.0)
+		{
+			for(auto& z: params.ZT)
+				values.push_back(EnergyLoss::Hydrogen_dEdx_Low(ePerU, z));
+		}
+		else
+			return 0.0;
+
+		if(params.ZP > 1)
+		{
+			for(unsigned int i=0; i<values.size(); i++)
+				values[i] *= EnergyLoss::CalculateEffectiveChargeRatio(ePerU, params.ZP, params.ZT[i]);
+		}
+
+		double stopping_total = 0;
+		double conversion_factor = 0;
+		for(size_t i=0; i< params.ZT.size(); i++)
+		{
+			conversion_factor += params.composition[i]*EnergyLoss::naturalMassList[params.ZT[i]];
+			stopping_total += values[i]*params.composition[i];
+		}
+		return stopping_total*EnergyLoss::avogadro/conversion_factor;
+	}
+
+	void ElectronicStoppingTest()
+	{
+		std::cout<<"----------ElectronicStopping Unit Tests---------"<<std::endl;
+		std::vector<std::vector<int>> targetZ = {{6}, {5, 6}, {3, 9}, {1, 6, 7, 8}};
+		std::vector<std::vector<int>> targetS = {{1}, {9, 1}, {1, 1}, {22, 10, 2, 5}};
+		std::vector<std::pair<int, int>> projectiles = {{1, 1}, {2, 4}, {3, 7}, {6, 12}};
+		RandomGenerator& generator = RandomGenerator::GetInstance();
+		generator.SetStream(5, 0);
+		const int samples = 100000;
+		double max_error = 0.0, legacy_sum = 0.0, current_sum = 0.0;
+		float legacy_duration = 0.0, current_duration = 0.0;
+		std::vector<double> energies(samples);
+		for(size_t t=0; t<targetZ.size(); t++)
+		{
+			Target target(targetZ[t], targetS[t], 50.0);
+			for(auto& projectile : projectiles)
+			{
+				EnergyLoss::Parameters params = ProjectileParameters(target, projectile);
+				//log-uniform from 1 keV/u to 10 MeV/u, covering all three regimes
+				for(auto& energy : energies)
+					energy = params.massP*1.0e-3*std::pow(10.0, 4.0*generator.Uniform());
+
+				Timer stopwatch("StoppingTimer");
+				for(auto& energy : energies)
+					legacy_sum += LegacyElectronicStoppingPower(params, energy);
+				legacy_duration += stopwatch.ElapsedMilliseconds();
+				stopwatch.Restart();
+				for(auto& energy : energies)
+					current_sum += EnergyLoss::GetElectronicStoppingPower(params, energy);
+				current_duration += stopwatch.ElapsedMilliseconds();
+
+				for(auto& energy : energies)
+				{
+					double legacy = LegacyElectronicStoppingPower(params, energy);
+					max_error = std::max(max_error, std::fabs(EnergyLoss::GetElectronicStoppingPower(params, energy) - legacy)/legacy);
+				}
+			}
+		}
+		ReportMaxDifference("from the previous evaluation", max_error, 1.0e-12);
+		std::cout<<samples*targetZ.size()*projectiles.size()<<" evaluations, before: "<<legacy_duration<<" ms after: "<<current_duration
+				 <<" ms (checksums "<<legacy_sum<<" "<<current_sum<<")"<<std::endl;
+		std::cout<<"------------------------------------------------"<<std::endl;
+	}
+
+	//Fine fourth order integration of the analytic stopping power, the reference for the range table
+	double ReferenceEnergyLoss(const EnergyLoss::Parameters& params, double startEnergy, double thickness, bool reverse)
+	{
+		const int nsteps = 20000;
+		double sign = reverse ? -1.0 : 1.0;
+		double h = thickness/nsteps;
+		double energy = startEnergy;
+		auto slope = [&params, sign](double e) { return sign*EnergyLoss::GetTotalStoppingPower(params, e)/1000.0; };
+		for(int i=0; i<nsteps; i++)
+		{
+			double k1 = slope(energy);
+			double k2 = slope(energy - 0.5*h*k1);
+			double k3 = slope(energy - 0.5*h*k2);
+			double k4 = slope(energy - h*k3);
+			energy -= h*(k1 + 2.0*k2 + 2.0*k3 + k4)/6.0;
+		}
+		return sign*(startEnergy - energy);
+	}
+
+	void RangeTableTest()
+	{
+		std::cout<<"------------RangeTable Unit Tests---------------"<<std::endl;
+		std::vector<std::vector<int>> targetZ = {{6}, {5, 6}, {79}};
+		std::vector<std::vector<int>> targetS = {{1}, {9, 1}, {1}};
+		std::vector<std::pair<int, int>> projectiles = {{1, 1}, {2, 3}, {2, 4}, {6, 12}};
+		RandomGenerator& generator = RandomGenerator::GetInstance();
+		generator.SetStream(4, 0);
+		const int samples = 20;
+		double max_error = 0.0, max_reverse_error = 0.0;
+		for(size_t t=0; t<targetZ.size(); t++)
+		{
+			Target target(targetZ[t], targetS[t], 100.0);
+			for(auto& projectile : projectiles)
+			{
+				target.RegisterProjectile(projectile.first, projectile.second);
+				EnergyLoss::Parameters params = ProjectileParameters(target, projectile);
+				for(int i=0; i<samples; i++)
+				{
+					double energy = 0.5 + 29.5*generator.Uniform();
+					double theta = 1.2*generator.Uniform();
+					double thickness = 100.0/std::cos(theta);
+
+					double reference = ReferenceEnergyLoss(params, energy, thickness, false);
+					if(reference < 0.9*energy) //not stopped in the target
+						max_error = std::max(max_error, std::fabs(target.GetEnergyLossTotal(projectile.first, projectile.second, energy, theta) - reference)/reference);
+					reference = ReferenceEnergyLoss(params, energy, thickness, true);
+					max_reverse_error = std::max(max_reverse_error, std::fabs(target.GetReverseEnergyLossTotal(projectile.first, projectile.second, energy, theta) - reference)/reference);
+				}
+			}
+		}
+		ReportMaxDifference("of energy loss from fine integration", max_error, 1.0e-4);
+		ReportMaxDifference("of reverse energy loss from fine integration", max_reverse_error, 1.0e-4);
+
+		Target tabulated({6}, {1}, 100.0), formula({6}, {1}, 100.0);
+		tabulated.RegisterProjectile(2, 4);
+		std::cout<<"Zero depth energy loss: "<<tabulated.GetEnergyLossFractionalDepth(2, 4, 10.0, 0.0, 0.0)<<std::endl;
+		const int nevents = 100000;
+		double table_sum = 0.0, formula_sum = 0.0;
+		Timer stopwatch("RangeTimer");
+		for(int i=0; i<nevents; i++)
+			table_sum += tabulated.GetEnergyLossTotal(2, 4, 1.0 + i*1.0e-4, 0.3);
+		float table_duration = stopwatch.ElapsedMilliseconds();
+		stopwatch.Restart();
+		for(int i=0; i<nevents; i++)
+			formula_sum += formula.GetEnergyLossTotal(2, 4, 1.0 + i*1.0e-4, 0.3);
+		float formula_duration = stopwatch.ElapsedMilliseconds();
+		std::cout<<"4He through 100 ug/cm^2 C, range table: "<<nevents<<" energy losses in "<<table_duration<<" ms, integration: "
+				 <<formula_duration<<" ms (checksums "<<table_sum<<" "<<formula_sum<<")"<<std::endl;
+		std::cout<<"------------------------------------------------"<<std::endl;
+	}
+
+	//Energy loss, adding the integration counts of this call to counts
+	double CountedEnergyLoss(const EnergyLoss::Parameters& params, double energy, double thickness, EnergyLoss::IntegrationStats& counts)
+	{
+		EnergyLoss::IntegrationStats before = EnergyLoss::GetThreadIntegrationStats();
+		double loss = EnergyLoss::GetEnergyLoss(params, energy, thickness);
+		const EnergyLoss::IntegrationStats& after = EnergyLoss::GetThreadIntegrationStats();
+		counts.calls += after.calls - before.calls;
+		counts.steps += after.steps - before.steps;
+		counts.rejectedSteps += after.rejectedSteps - before.rejectedSteps;
+		counts.evaluations += after.evaluations - before.evaluations;
+		counts.thinTarget += after.thinTarget - before.thinTarget;
+		return loss;
+	}
+
+	void IntegratorTest()
+	{
+		std::cout<<"------------Integrator Unit Tests---------------"<<std::endl;
+		std::vector<std::vector<int>> targetZ = {{6}, {5, 6}, {79}};
+		std::vector<std::vector<int>> targetS = {{1}, {9, 1}, {1}};
+		std::vector<std::pair<int, int>> projectiles = {{1, 1}, {2, 4}, {6, 12}};
+		std::vector<double> thicknesses = {100.0, 2000.0}; //ug/cm^2
+		const double tolerance = 1.0e-6;
+		RandomGenerator& generator = RandomGenerator::GetInstance();
+		generator.SetStream(6, 0);
+		const int samples = 10;
+		double max_euler_error = 0.0, max_dopri_error = 0.0;
+		EnergyLoss::IntegrationStats eulerStats, dopriStats;
+		for(size_t t=0; t<targetZ.size(); t++)
+		{
+			for(auto& projectile : projectiles)
+			{
+				for(auto& thickness : thicknesses)
+				{
+					EnergyLoss::Parameters params = ProjectileParameters(Target(targetZ[t], targetS[t], thickness), projectile);
+					for(int i=0; i<samples; i++)
+					{
+						double energy = 1.0 + 29.0*generator.Uniform();
+						double reference = ReferenceEnergyLoss(params, energy, thickness, false);
+						EnergyLoss::SetIntegrator(EnergyLoss::Integrator::Euler, tolerance);
+						double euler = CountedEnergyLoss(params, energy, thickness, eulerStats);
+						EnergyLoss::SetIntegrator(EnergyLoss::Integrator::DormandPrince, tolerance);
+						double dopri = CountedEnergyLoss(params, energy, thickness, dopriStats);
+						if(reference < 0.9*energy) //not stopped in the target
+						{
+							max_euler_error = std::max(max_euler_error, std::fabs(euler - reference)/(energy - reference));
+							max_dopri_error = std::max(max_dopri_error, std::fabs(dopri - reference)/(energy - reference));
+						}
+					}
+				}
+			}
+		}
+		EnergyLoss::SetIntegrator(EnergyLoss::Integrator::Euler, tolerance);
+		std::cout<<"Max error in final energy relative to fine integration, euler: "<<max_euler_error<<" dopri5 (tolerance "<<tolerance
+				 <<"): "<<max_dopri_error<<std::endl;
+		//the tolerance is per step, so the error of the whole integration can be a few times larger
+		bool good = max_dopri_error < 20.0*tolerance && dopriStats.evaluations < eulerStats.evaluations;
+		std::cout<<"euler: "<<eulerStats.calls<<" calls, "<<eulerStats.steps<<" steps, "<<eulerStats.evaluations<<" evaluations"<<std::endl;
+		std::cout<<"dopri5: "<<dopriStats.calls<<" calls, "<<dopriStats.steps<<" steps ("<<dopriStats.rejectedSteps<<" rejected), "
+				 <<dopriStats.evaluations<<" evaluations"<<(good ? " PASS" : " FAIL")<<std::endl;
+		std::cout<<"------------------------------------------------"<<std::endl;
+	}
+
+	void BatchEnergyLossTest()
+	{
+		std::cout<<"-----------BatchEnergyLoss Unit Tests-----------"<<std::endl;
+		const size_t n = 100000;
+		std::vector<double> energy(n), theta(n), depth(n), batch(n), single(n);
+		RandomGenerator& generator = RandomGenerator::GetInstance();
+		generator.SetStream(7, 0);
+		for(size_t i=0; i<n; i++)
+		{
+			energy[i] = 0.01 + 30.0*generator.Uniform();
+			theta[i] = M_PI*generator.Uniform();
+			depth[i] = generator.Uniform();
+		}
+		theta[0] = M_PI/2.0;
+		depth[1] = 0.0;
+		energy[2] = 0.0;
+
+		Target target({6}, {1}, 100.0);
+		target.RegisterProjectile(2, 4);
+		bool good = true;
+		float batch_duration = 0.0, single_duration = 0.0;
+		//4He has a range table, 3He does not and is integrated particle by particle
+		for(auto& projectile : std::vector<std::pair<int, int>>({{2, 4}, {2, 3}}))
+		{
+			for(bool reverse : {false, true})
+			{
+				size_t nevents = projectile.second == 4 ? n : n/100;
+				Timer stopwatch("BatchTimer");
+				if(reverse)
+					target.GetReverseEnergyLossBatch(projectile.first, projectile.second, energy.data(), theta.data(), depth.data(), batch.data(), nevents);
+				else
+					target.GetEnergyLossBatch(projectile.first, projectile.second, energy.data(), theta.data(), depth.data(), batch.data(), nevents);
+				float duration = stopwatch.ElapsedMilliseconds();
+				stopwatch.Restart();
+				for(size_t i=0; i<nevents; i++)
+				{
+					single[i] = reverse ? target.GetReverseEnergyLossFractionalDepth(projectile.first, projectile.second, energy[i], theta[i], depth[i])
+										: target.GetEnergyLossFractionalDepth(projectile.first, projectile.second, energy[i], theta[i], depth[i]);
+				}
+				if(projectile.second == 4)
+				{
+					batch_duration += duration;
+					single_duration += stopwatch.ElapsedMilliseconds();
+				}
+				for(size_t i=0; i<nevents; i++)
+					good &= batch[i] == single[i];
+			}
+		}
+		std::cout<<"Batch results identical to single particle results"<<(good ? " PASS" : " FAIL")<<std::endl;
+		std::cout<<"4He through C, "<<2*n<<" particles, batch: "<<batch_duration<<" ms single: "<<single_duration<<" ms"<<std::endl;
+		std::cout<<"------------------------------------------------"<<std::endl;
+	}
+
+	//One Target shared by many threads must give exactly the serial results
+	void TargetThreadTest()
+	{
+		std::cout<<"------------Target Thread Unit Tests------------"<<std::endl;
+		const size_t n = 20000;
+		std::vector<double> energy(n), theta(n), depth(n);
+		RandomGenerator& generator = RandomGenerator::GetInstance();
+		generator.SetStream(8, 0);
+		for(size_t i=0; i<n; i++)
+		{
+			energy[i] = 0.5 + 20.0*generator.Uniform();
+			theta[i] = M_PI*generator.Uniform();
+			depth[i] = generator.Uniform();
+		}
+
+		Target target({5, 6}, {9, 1}, 100.0);
+		target.RegisterProjectile(2, 4);
+		const Target& shared = target;
+		//4He has a range table, protons are integrated; every entry point is used
+		auto evaluate = [&shared, &energy, &theta, &depth](size_t i)
+		{
+			int zp = i % 2 == 0 ? 2 : 1;
+			int ap = i % 2 == 0 ? 4 : 1;
+			switch(i % 4)
+			{
+				case 0: case 1: return shared.GetEnergyLossFractionalDepth(zp, ap, energy[i], theta[i], depth[i]);
+				case 2: return shared.GetReverseEnergyLossFractionalDepth(zp, ap, energy[i], theta[i], depth[i]);
+				default: return shared.GetEnergyLossTotal(zp, ap, energy[i], theta[i]);
+			}
+		};
+
+		std::vector<double> serial(n), parallel(n), serialBatch(n), parallelBatch(n);
+		for(size_t i=0; i<n; i++)
+			serial[i] = evaluate(i);
+		shared.GetEnergyLossBatch(1, 1, energy.data(), theta.data(), depth.data(), serialBatch.data(), n);
+
+		int nthreads = 8;
+		ThreadPool pool(nthreads);
+		pool.ParallelFor(0, n, 64, [&evaluate, &parallel](uint64_t first, uint64_t last) {
+			for(uint64_t i=first; i<last; i++)
+				parallel[i] = evaluate(i);
+		});
+		pool.ParallelFor(0, n, 256, [&shared, &energy, &theta, &depth, &parallelBatch](uint64_t first, uint64_t last) {
+			shared.GetEnergyLossBatch(1, 1, energy.data() + first, theta.data() + first, depth.data() + first, parallelBatch.data() + first, last - first);
+		});
+		pool.Wait();
+
+		bool good = serial == parallel && serialBatch == parallelBatch;
+		std::cout<<"Threads: "<<nthreads<<" sharing one target, "<<2*n<<" energy losses identical to serial"<<(good ? " PASS" : " FAIL")<<std::endl;
+		std::cout<<"------------------------------------------------"<<std::endl;
+	}
+
+	void ThinTargetTest()
+	{
+		std::cout<<"------------ThinTarget Unit Tests---------------"<<std::endl;
+		std::vector<std::vector<int>> targetZ = {{6}, {5, 6}, {79}};
+		std::vector<std::vector<int>> targetS = {{1}, {9, 1}, {1}};
+		std::vector<std::pair<int, int>> projectiles = {{1, 1}, {2, 3}, {2, 4}, {3, 7}};
+		RandomGenerator& generator = RandomGenerator::GetInstance();
+		generator.SetStream(9, 0);
+		const int samples = 200;
+		double max_thin_error = 0.0;
+		EnergyLoss::IntegrationStats counts;
+		float duration = 0.0;
+		for(size_t t=0; t<targetZ.size(); t++)
+		{
+			for(auto& projectile : projectiles)
+			{
+				//no table: the thin target formula or the integrator
+				EnergyLoss::Parameters params = ProjectileParameters(Target(targetZ[t], targetS[t], 50.0), projectile);
+				for(int i=0; i<samples; i++)
+				{
+					double energy = 1.0 + 29.0*generator.Uniform();
+					double thickness = 50.0*generator.Uniform()/std::cos(1.2*generator.Uniform());
+					uint64_t nthin = counts.thinTarget;
+					Timer stopwatch("ThinTimer");
+					double loss = CountedEnergyLoss(params, energy, thickness, counts);
+					duration += stopwatch.ElapsedMilliseconds();
+					if(counts.thinTarget != nthin)
+					{
+						double reference = ReferenceEnergyLoss(params, energy, thickness, false);
+						max_thin_error = std::max(max_thin_error, std::fabs(loss - reference)/reference);
+					}
+				}
+			}
+		}
+		std::cout<<"Thin target fast path: "<<counts.thinTarget<<" of "<<counts.calls<<" energy losses ("<<100.0*counts.thinTarget/counts.calls
+				 <<"%), "<<counts.evaluations<<" evaluations in "<<duration<<" ms"<<std::endl;
+		ReportMaxDifference("of fast path energy loss from fine integration", max_thin_error, 1.0e-4);
+		std::cout<<"------------------------------------------------"<<std::endl;
+	}
+
+	void EnergyLossCacheTest()
+	{
+		std::cout<<"------------EnergyLossCache Unit Tests---------------"<<std::endl;
+		//Unregistered species (no table) in a beam-like spread of energies, the case the cache is for
+		std::vector<std::vector<int>> targetZ = {{6}, {5, 6}, {79}};
+		std::vector<std::vector<int>> targetS = {{1}, {9, 1}, {1}};
+		std::vector<std::pair<int, int>> projectiles = {{1, 1}, {2, 3}, {2, 4}, {3, 7}};
+		const double quantization = 0.01;
+		//A tight integrator, so that the comparison is of the interpolation and not of the step noise of the integrator
+		EnergyLoss::Integrator integrator = EnergyLoss::GetIntegrator();
+		double tolerance = EnergyLoss::GetIntegratorTolerance();
+		EnergyLoss::SetIntegrator(EnergyLoss::Integrator::DormandPrince, 1.0e-9);
+		RandomGenerator& generator = RandomGenerator::GetInstance();
+		generator.SetStream(10, 0);
+		const int samples = 2000;
+		double max_error = 0.0;
+		float direct_duration = 0.0, cached_duration = 0.0;
+		EnergyLossCache::Stats start = EnergyLossCache::GetThreadStats();
+		for(size_t t=0; t<targetZ.size(); t++)
+		{
+			Target target(targetZ[t], targetS[t], 100.0);
+			for(auto& projectile : projectiles)
+			{
+				double beamEnergy = 5.0 + 20.0*generator.Uniform();
+				for(int i=0; i<samples; i++)
+				{
+					double energy = beamEnergy + 0.05*(generator.Uniform() - 0.5);
+					double theta = 0.5*generator.Uniform();
+					double depth = generator.Uniform();
+
+					EnergyLossCache::SetQuantization(0.0);
+					Timer stopwatch("CacheTimer");
+					double direct = target.GetEnergyLossFractionalDepth(projectile.first, projectile.second, energy, theta, depth);
+					direct_duration += stopwatch.ElapsedMilliseconds();
+
+					EnergyLossCache::SetQuantization(quantization);
+					stopwatch.Restart();
+					double cached = target.GetEnergyLossFractionalDepth(projectile.first, projectile.second, energy, theta, depth);
+					cached_duration += stopwatch.ElapsedMilliseconds();
+					if(direct > 0.0)
+						max_error = std::max(max_error, std::fabs(cached - direct)/direct);
+				}
+			}
+		}
+		EnergyLossCache::SetQuantization(0.0);
+		EnergyLoss::SetIntegrator(integrator, tolerance);
+		EnergyLossCache::Stats end = EnergyLossCache::GetThreadStats();
+		uint64_t hits = end.hits - start.hits;
+		uint64_t misses = end.misses - start.misses;
+		std::cout<<"Quantization: "<<quantization<<" hits: "<<hits<<" misses: "<<misses<<" ("<<100.0*hits/(hits + misses)<<"% hit rate)"<<std::endl;
+		std::cout<<"Direct: "<<direct_duration<<" ms cached: "<<cached_duration<<" ms"<<std::endl;
+		ReportMaxDifference("of cached energy loss from direct", max_error, quantization*quantization);
+		std::cout<<"------------------------------------------------"<<std::endl;
+	}
+
+	void ProjectileHandleTest()
+	{
+		std::cout<<"------------ProjectileHandle Unit Tests---------------"<<std::endl;
+		Target target({5, 6}, {9, 1}, 100.0);
+		std::vector<std::pair<int, int>> projectiles = {{1, 1}, {1, 2}, {2, 3}, {2, 4}, {3, 7}};
+		std::vector<Target::ProjectileHandle> handles;
+		for(auto& projectile : projectiles)
+			handles.push_back(target.RegisterProjectile(projectile.first, projectile.second));
+		//Copies (as every chunk of a chain has) keep the species in the same order, so the handles carry over
+		Target copy = target;
+
+		RandomGenerator& generator = RandomGenerator::GetInstance();
+		generator.SetStream(11, 0);
+		const int samples = 20000;
+		bool same = true;
+		double sumHandle = 0.0, sumZA = 0.0;
+		float handle_duration = 0.0, za_duration = 0.0;
+		for(int i=0; i<samples; i++)
+		{
+			size_t p = i % projectiles.size();
+			double energy = 1.0 + 29.0*generator.Uniform();
+			double theta = M_PI*generator.Uniform();
+			double depth = generator.Uniform();
+
+			Timer stopwatch("HandleTimer");
+			double lossHandle = copy.GetEnergyLossFractionalDepth(handles[p], energy, theta, depth);
+			handle_duration += stopwatch.ElapsedMilliseconds();
+			stopwatch.Restart();
+			double lossZA = target.GetEnergyLossFractionalDepth(projectiles[p].first, projectiles[p].second, energy, theta, depth);
+			za_duration += stopwatch.ElapsedMilliseconds();
+
+			same &= lossHandle == lossZA;
+			same &= copy.GetReverseEnergyLossFractionalDepth(handles[p], energy, theta, depth) ==
+					target.GetReverseEnergyLossFractionalDepth(projectiles[p].first, projectiles[p].second, energy, theta, depth);
+			sumHandle += lossHandle;
+			sumZA += lossZA;
+		}
+		//Neutral species get no handle, and an invalid handle loses no energy
+		Target::ProjectileHandle neutron = target.RegisterProjectile(0, 1);
+		bool neutral = !neutron.IsValid() && target.GetEnergyLossFractionalDepth(neutron, 10.0, 0.3, 0.5) == 0.0;
+		std::cout<<"Handle: "<<handle_duration<<" ms (Z,A): "<<za_duration<<" ms ("<<sumHandle<<" "<<sumZA<<")"<<std::endl;
+		std::cout<<"Energy losses by handle identical to (Z,A)"<<(same ? " PASS" : " FAIL")<<std::endl;
+		std::cout<<"Invalid handle loses no energy"<<(neutral ? " PASS" : " FAIL")<<std::endl;
+		std::cout<<"------------------------------------------------"<<std::endl;
+	}
+
+	void MultiLayerTargetTest()
+	{
+		std::cout<<"------------MultiLayerTarget Unit Tests---------------"<<std::endl;
+		//10B on a carbon backing, reactions in the boron
+		const double boron = 50.0, carbon = 30.0;
+		Target target({5}, {1}, boron);
+		target.AddLayer({6}, {1}, carbon);
+		target.SetReactionLayer(target.FindLayer(5));
+		std::vector<std::pair<int, int>> projectiles = {{1, 1}, {2, 3}, {2, 4}};
+		std::vector<Target::ProjectileHandle> handles;
+		for(auto& projectile : projectiles)
+			handles.push_back(target.RegisterProjectile(projectile.first, projectile.second));
+
+		RandomGenerator& generator = RandomGenerator::GetInstance();
+		generator.SetStream(12, 0);
+		const size_t n = 60;
+		double max_error = 0.0;
+		bool batch_same = true;
+		for(size_t p=0; p<projectiles.size(); p++)
+		{
+			EnergyLoss::Parameters boronParams = ProjectileParameters(target, projectiles[p], 0);
+			EnergyLoss::Parameters carbonParams = ProjectileParameters(target, projectiles[p], 1);
+
+			std::vector<double> energy(n), theta(n), fraction(n), ejectile(n), beam(n), ejectileBatch(n), beamBatch(n);
+			for(size_t i=0; i<n; i++)
+			{
+				energy[i] = 2.0 + 23.0*generator.Uniform();
+				theta[i] = 3.0*generator.Uniform();
+				fraction[i] = generator.Uniform();
+				ejectile[i] = target.GetEjectileEnergyLoss(handles[p], energy[i], theta[i], fraction[i]);
+				beam[i] = target.GetBeamEnergyLoss(handles[p], energy[i], fraction[i]);
+
+				//Fine integration through the layers crossed: the rest of the boron and the backing going forwards, the front
+				//part of the boron going backwards
+				double cosTheta = std::fabs(std::cos(theta[i]));
+				double reference;
+				if(theta[i] < M_PI/2.)
+				{
+					reference = ReferenceEnergyLoss(boronParams, energy[i], (boron - fraction[i]*boron)/cosTheta, false);
+					reference += ReferenceEnergyLoss(carbonParams, energy[i] - reference, carbon/cosTheta, false);
+				}
+				else
+					reference = ReferenceEnergyLoss(boronParams, energy[i], fraction[i]*boron/cosTheta, false);
+				if(reference < 0.9*energy[i])
+					max_error = std::max(max_error, std::fabs(ejectile[i] - reference)/reference);
+				double beamReference = ReferenceEnergyLoss(boronParams, energy[i], fraction[i]*boron, false);
+				if(beamReference > 0.0)
+					max_error = std::max(max_error, std::fabs(beam[i] - beamReference)/beamReference);
+			}
+			target.GetEjectileEnergyLossBatch(handles[p], energy.data(), theta.data(), fraction.data(), ejectileBatch.data(), n);
+			target.GetBeamEnergyLossBatch(handles[p], energy.data(), fraction.data(), beamBatch.data(), n);
+			batch_same &= ejectile == ejectileBatch && beam == beamBatch;
+		}
+
+		//A target split into two layers of the same material loses the same energy as the whole
+		Target whole({6}, {1}, boron + carbon);
+		Target split({6}, {1}, boron);
+		split.AddLayer({6}, {1}, carbon);
+		Target::ProjectileHandle wholeAlpha = whole.RegisterProjectile(2, 4), splitAlpha = split.RegisterProjectile(2, 4);
+		double max_split = 0.0;
+		for(int i=0; i<100; i++)
+		{
+			double energy = 2.0 + 0.2*i;
+			double lossWhole = whole.GetEnergyLossTotal(wholeAlpha, energy, 0.5);
+			max_split = std::max(max_split, std::fabs(split.GetEnergyLossTotal(splitAlpha, energy, 0.5) - lossWhole)/lossWhole);
+		}
+
+		std::cout<<"Layers: "<<target.GetNumberOfLayers()<<" reaction layer: "<<target.GetReactionLayer()<<" range tables: "<<target.GetNumberOfTables()<<std::endl;
+		ReportMaxDifference("of layered energy loss from fine integration", max_error, 1.0e-4);
+		std::cout<<"Batch identical to single particle"<<(batch_same ? " PASS" : " FAIL")<<std::endl;
+		ReportMaxDifference("of split target from whole", max_split, 1.0e-9);
+		std::cout<<"------------------------------------------------"<<std::endl;
+	}
+}
@@ -2,12 +2,17 @@
 #define THREAD_POOL_H
 
 #include <vector>
+#include <deque>
 #include <atomic>
 #include <thread>
 #include <mutex>
 #include <functional>
-#include <queue>
+#include <future>
+#include <memory>
 #include <condition_variable>
+#include <cstdint>
+#include <algorithm>
+#include <exception>
 
 
 namespace NucKage {
@@ -19,15 +24,27 @@ namespace NucKage {
 		int argument;
 	};
 
+	/*
+		Work-stealing thread pool. Every worker owns a deque of tasks. Tasks submitted from outside the pool are dealt
+		round-robin to the workers, tasks submitted from inside a worker go to that worker's own deque. A worker takes
+		work from the front of its own deque and, once that is empty, steals from the back of the other workers' deques,
+		so uneven jobs (chains of very different cost) still keep every worker busy. Idle workers sleep on a condition
+		variable, they never spin.
+	*/
 	class ThreadPool
 	{
 	public:
+		using Task = std::function<void()>;
+
 		ThreadPool(int nthreads) :
-			m_isStopped(false), m_numberRunning(0), m_queueSize(0), m_initShutdown(false)
+			m_nWorkers(std::max(nthreads, 1)), m_isStopped(false), m_numberOutstanding(0), m_numberCompleted(0),
+			m_numberQueued(0), m_nextQueue(0), m_initShutdown(false)
 		{
-			for(int i=0; i<nthreads; i++)
+			for(int i=0; i<m_nWorkers; i++)
+				m_queues.push_back(std::make_unique<WorkerQueue>());
+			for(int i=0; i<m_nWorkers; i++)
 			{
-				m_pool.push_back(std::thread(std::bind(&ThreadPool::ExecuteJob, std::ref(*this))));
+				m_pool.push_back(std::thread(&ThreadPool::ExecuteJob, this, i));
 			}
 		}
 		~ThreadPool()
@@ -36,24 +53,111 @@ namespace NucKage {
 				Shutdown();
 		}
 
+		//If a job throws, the first exception is kept and rethrown from Wait or WaitForCompleted
 		void PushJob(Job job)
 		{
-			{
-				std::unique_lock<std::mutex> guard(m_poolMutex);
-				m_queue.push(job);
-				m_queueSize++;
-			}
-			m_wakeCondition.notify_one();
+			PushTask([this, job]() {
+				try
+				{
+					job.func(job.argument);
+				}
+				catch(...)
+				{
+					std::unique_lock<std::mutex> guard(m_poolMutex);
+					if(!m_exception)
+						m_exception = std::current_exception();
+				}
+			});
 		}
 
+		//Submit a callable, the returned future gives its result (or rethrows its exception)
+		template<typename Func>
+		auto Submit(Func&& func) -> std::future<decltype(func())>
+		{
+			using Result = decltype(func());
+			auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Func>(func));
+			std::future<Result> result = task->get_future();
+			PushTask([task]() { (*task)(); });
+			return result;
+		}
+
+		//Run func(first, last) over [begin, end) split into pieces of at most grain elements, and wait for all of them
+		void ParallelFor(uint64_t begin, uint64_t end, uint64_t grain, const std::function<void(uint64_t, uint64_t)>& func);
+
+		inline int GetNumberOfWorkers() const { return m_nWorkers; }
+		//Index of the calling worker thread in [0, GetNumberOfWorkers()), -1 when not called from a worker
+		inline static int GetWorkerIndex() { return s_workerIndex; }
+		inline bool IsWorkerThread() const { return s_owner == this; }
+
+		//A job is outstanding from PushJob until its function has returned
 		bool IsFinished()
 		{
-			return m_numberRunning == 0 && m_queueSize == 0;
+			std::unique_lock<std::mutex> guard(m_poolMutex);
+			return m_numberOutstanding == 0;
+		}
+
+		uint64_t GetNumberCompleted()
+		{
+			std::unique_lock<std::mutex> guard(m_poolMutex);
+			return m_numberCompleted;
+		}
+
+		//Block (no spinning) until every pushed job has finished
+		void Wait()
+		{
+			std::unique_lock<std::mutex> guard(m_poolMutex);
+			m_doneCondition.wait(guard, [this]() {
+				return m_numberOutstanding == 0;
+			});
+			RethrowJobException();
+		}
+
+		//Block until at least ncompleted jobs have finished over the lifetime of the pool, or a job has thrown
+		void WaitForCompleted(uint64_t ncompleted)
+		{
+			std::unique_lock<std::mutex> guard(m_poolMutex);
+			m_doneCondition.wait(guard, [this, ncompleted]() {
+				return m_numberCompleted >= ncompleted || m_exception;
+			});
+			RethrowJobException();
+		}
+
+		//Run one queued task on the calling thread if there is one. Used by workers that wait on other tasks.
+		bool RunPendingTask()
+		{
+			Task task;
+			int index = IsWorkerThread() ? s_workerIndex : 0;
+			if(!TryPop(index, task) && !TrySteal(index, task))
+				return false;
+			RunTask(task);
+			return true;
+		}
+
+		//Sleep until a task is queued, the pool shuts down or done() holds. Whatever makes done() true must call
+		//NotifyWaiters afterwards.
+		template<typename Pred>
+		void WaitForTaskOr(Pred done)
+		{
+			std::unique_lock<std::mutex> guard(m_poolMutex);
+			m_wakeCondition.wait(guard, [this, &done]() {
+				return m_numberQueued > 0 || m_initShutdown || done();
+			});
+		}
+
+		void NotifyWaiters()
+		{
+			{
+				std::unique_lock<std::mutex> guard(m_poolMutex);
+			}
+			m_wakeCondition.notify_all();
 		}
 
 		void Shutdown()
 		{
-			m_initShutdown = true;
+			{
+				std::unique_lock<std::mutex> guard(m_poolMutex);
+				m_initShutdown = true;
+			}
 			m_wakeCondition.notify_all();
 			for(auto& thread : m_pool)
 			{
@@ -65,43 +169,225 @@ namespace NucKage {
 		}
 
 	private:
-		void ExecuteJob()
+		struct WorkerQueue
+		{
+			std::mutex mutex;
+			std::deque<Task> tasks;
+		};
+
+		void PushTask(Task&& task)
+		{
+			int index = IsWorkerThread() ? s_workerIndex : int(m_nextQueue++ % m_nWorkers);
+			//The counts are raised before the task is visible to TryPop/TrySteal, so m_numberQueued can never drop below zero.
+			//Lock order is always m_poolMutex then a queue mutex.
+			{
+				std::unique_lock<std::mutex> guard(m_poolMutex);
+				m_numberOutstanding++;
+				m_numberQueued++;
+				std::unique_lock<std::mutex> queueGuard(m_queues[index]->mutex);
+				m_queues[index]->tasks.push_back(std::move(task));
+			}
+			m_wakeCondition.notify_one();
+		}
+
+		//Called with m_poolMutex held
+		void RethrowJobException()
+		{
+			std::exception_ptr exception;
+			std::swap(exception, m_exception);
+			if(exception)
+				std::rethrow_exception(exception);
+		}
+
+		bool TryPop(int index, Task& task)
 		{
+			WorkerQueue& queue = *m_queues[index];
+			std::unique_lock<std::mutex> guard(queue.mutex);
+			if(queue.tasks.empty())
+				return false;
+			task = std::move(queue.tasks.front());
+			queue.tasks.pop_front();
+			m_numberQueued--;
+			return true;
+		}
+
+		bool TrySteal(int index, Task& task)
+		{
+			for(int i=1; i<m_nWorkers; i++)
+			{
+				WorkerQueue& queue = *m_queues[(index + i) % m_nWorkers];
+				std::unique_lock<std::mutex> guard(queue.mutex);
+				if(queue.tasks.empty())
+					continue;
+				task = std::move(queue.tasks.back());
+				queue.tasks.pop_back();
+				m_numberQueued--;
+				return true;
+			}
+			return false;
+		}
+
+		void RunTask(Task& task)
+		{
+			task();
+
+			//Counts change under the lock, so a waiter can never miss the notification
+			{
+				std::unique_lock<std::mutex> guard(m_poolMutex);
+				m_numberOutstanding--;
+				m_numberCompleted++;
+			}
+			m_doneCondition.notify_all();
+		}
+
+		void ExecuteJob(int index)
+		{
+			s_workerIndex = index;
+			s_owner = this;
 			while(true)
 			{
-				Job job;
+				Task task;
+				if(TryPop(index, task) || TrySteal(index, task))
 				{
-					std::unique_lock<std::mutex> guard(m_poolMutex);
-					m_wakeCondition.wait(guard, [this](){ 
-						return (!m_queue.empty() || m_initShutdown); 
-					});
-					if(m_initShutdown)
-						return;
-	
-					job = m_queue.front();
-					m_queue.pop();
+					RunTask(task);
+					continue;
 				}
 
-				//Change number running first so that no crash 
-				m_numberRunning++;
-				m_queueSize--;
-
-				job.func(job.argument);
-				m_numberRunning--;
+				std::unique_lock<std::mutex> guard(m_poolMutex);
+				m_wakeCondition.wait(guard, [this](){
+					return (m_numberQueued > 0 || m_initShutdown);
+				});
+				if(m_initShutdown)
+					return;
 			}
-			
+
 		}
 
-		std::queue<Job, std::deque<Job>> m_queue;
+		std::vector<std::unique_ptr<WorkerQueue>> m_queues;
 		std::vector<std::thread> m_pool;
 		std::mutex m_poolMutex;
 		std::condition_variable m_wakeCondition;
+		std::condition_variable m_doneCondition;
 
+		int m_nWorkers;
 		bool m_isStopped;
-		std::atomic<int> m_numberRunning;
-		std::atomic<int> m_queueSize;
-		std::atomic<bool> m_initShutdown;
+		uint64_t m_numberOutstanding;
+		uint64_t m_numberCompleted;
+		std::atomic<uint64_t> m_numberQueued; //changed under m_poolMutex when raised, so sleeping workers are not missed
+		std::atomic<uint64_t> m_nextQueue;
+		bool m_initShutdown;
+		std::exception_ptr m_exception; //first exception thrown by a PushJob job
+
+		inline static thread_local int s_workerIndex = -1;
+		inline static thread_local ThreadPool* s_owner = nullptr;
+	};
+
+	/*
+		A set of tasks that can be waited on independently of everything else in the pool. Waiting from a worker
+		thread runs other queued tasks in the meantime, so nested groups cannot deadlock the pool. If a task throws,
+		the first exception is rethrown from Wait().
+	*/
+	class TaskGroup
+	{
+	public:
+		TaskGroup(ThreadPool& pool) :
+			m_pool(pool), m_numberRunning(0)
+		{
+		}
+
+		//Never throws, an exception nobody waited for is dropped
+		~TaskGroup()
+		{
+			WaitForTasks();
+		}
+
+		template<typename Func>
+		void Run(Func&& func)
+		{
+			m_numberRunning++;
+			m_pool.Submit([this, func = std::forward<Func>(func)]() mutable {
+				Finisher finisher(*this); //releases the group even if func throws
+				try
+				{
+					func();
+				}
+				catch(...)
+				{
+					std::unique_lock<std::mutex> guard(m_groupMutex);
+					if(!m_exception)
+						m_exception = std::current_exception();
+				}
+			});
+		}
+
+		void Wait()
+		{
+			WaitForTasks();
+			std::exception_ptr exception;
+			{
+				std::unique_lock<std::mutex> guard(m_groupMutex);
+				std::swap(exception, m_exception);
+			}
+			if(exception)
+				std::rethrow_exception(exception);
+		}
+
+	private:
+		struct Finisher
+		{
+			Finisher(TaskGroup& g) : group(g) {}
+			~Finisher()
+			{
+				//Lock order is always m_groupMutex then the pool mutex
+				std::unique_lock<std::mutex> guard(group.m_groupMutex);
+				if(--group.m_numberRunning == 0)
+				{
+					group.m_doneCondition.notify_all();
+					group.m_pool.NotifyWaiters();
+				}
+			}
+			TaskGroup& group;
+		};
+
+		void WaitForTasks()
+		{
+			if(m_pool.IsWorkerThread())
+			{
+				//Help with queued work, and sleep until either more work is queued or our last task finishes
+				while(m_numberRunning > 0)
+				{
+					if(!m_pool.RunPendingTask())
+						m_pool.WaitForTaskOr([this]() { return m_numberRunning == 0; });
+				}
+				//The last Finisher may still hold the group lock, take it so the group outlives it
+				std::unique_lock<std::mutex> guard(m_groupMutex);
+				return;
+			}
+
+			std::unique_lock<std::mutex> guard(m_groupMutex);
+			m_doneCondition.wait(guard, [this]() {
+				return m_numberRunning == 0;
+			});
+		}
+
+		ThreadPool& m_pool;
+		std::atomic<uint64_t> m_numberRunning;
+		std::exception_ptr m_exception;
+		std::mutex m_groupMutex;
+		std::condition_variable m_doneCondition;
 	};
+
+	inline void ThreadPool::ParallelFor(uint64_t begin, uint64_t end, uint64_t grain, const std::function<void(uint64_t, uint64_t)>& func)
+	{
+		grain = std::max<uint64_t>(grain, 1);
+		TaskGroup group(*this);
+		for(uint64_t first=begin; first<end; first += grain)
+		{
+			uint64_t last = std::min(end, first + grain);
+			group.Run([&func, first, last]() { func(first, last); });
+		}
+		group.Wait();
+	}
 }
 
-#endif
\ No newline at end of file
+#endif
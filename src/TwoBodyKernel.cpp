@@ -0,0 +1,161 @@
+#include "TwoBodyKernel.h"
+#include <cmath>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace NucKage {
+
+	//Boost the CM ejectile to the lab by the parent velocity (same form as TLorentzVector::Boost), the residual is what is left of the parent
+	static inline void BoostAndStore(const TwoBodyColumns& columns, size_t i, double ejectE_cm, double ejectP_cm)
+	{
+		double parentPx = columns.parentPx[i], parentPy = columns.parentPy[i], parentPz = columns.parentPz[i];
+		double parentE = columns.parentE[i];
+		double cmPx = ejectP_cm*columns.directionX[i];
+		double cmPy = ejectP_cm*columns.directionY[i];
+		double cmPz = ejectP_cm*columns.directionZ[i];
+
+		double bx = parentPx/parentE, by = parentPy/parentE, bz = parentPz/parentE;
+		double b2 = bx*bx + by*by + bz*bz;
+		double gamma = 1.0/std::sqrt(1.0 - b2);
+		double bp = bx*cmPx + by*cmPy + bz*cmPz;
+		double gamma2bp = (b2 > 0.0 ? (gamma - 1.0)/b2 : 0.0)*bp;
+		double gammaE = gamma*ejectE_cm;
+		double ejectPx = cmPx + gamma2bp*bx + gammaE*bx;
+		double ejectPy = cmPy + gamma2bp*by + gammaE*by;
+		double ejectPz = cmPz + gamma2bp*bz + gammaE*bz;
+		double ejectE = gamma*(ejectE_cm + bp);
+
+		columns.ejectilePx[i] = ejectPx;
+		columns.ejectilePy[i] = ejectPy;
+		columns.ejectilePz[i] = ejectPz;
+		columns.ejectileE[i] = ejectE;
+		columns.residualPx[i] = parentPx - ejectPx;
+		columns.residualPy[i] = parentPy - ejectPy;
+		columns.residualPz[i] = parentPz - ejectPz;
+		columns.residualE[i] = parentE - ejectE;
+	}
+
+	/*
+		Per event: the parent invariant mass sets the CM energy and momentum of the ejectile, the CM momentum is placed along
+		the sampled direction and boosted to the lab.
+	*/
+	void CalculateTwoBodyScalar(const TwoBodyColumns& columns, double ejectileMass, double residualMass, size_t first, size_t last)
+	{
+		const double ejectMass2 = ejectileMass*ejectileMass;
+		for(size_t i=first; i<last; i++)
+		{
+			double parentPx = columns.parentPx[i], parentPy = columns.parentPy[i], parentPz = columns.parentPz[i];
+			double parentE = columns.parentE[i];
+			double residM = columns.residualExcitation ? residualMass + columns.residualExcitation[i] : residualMass;
+
+			double parentM2 = parentE*parentE - (parentPx*parentPx + parentPy*parentPy + parentPz*parentPz);
+			double parentM = std::sqrt(parentM2);
+			double ejectE_cm = (ejectMass2 - residM*residM + parentM2)/(2.0*parentM);
+			double ejectP_cm = std::sqrt(ejectE_cm*ejectE_cm - ejectMass2);
+			BoostAndStore(columns, i, ejectE_cm, ejectP_cm);
+		}
+	}
+
+	void CalculateTwoBodyFixedCMScalar(const TwoBodyColumns& columns, double ejectileE_cm, double ejectileP_cm, size_t first, size_t last)
+	{
+		for(size_t i=first; i<last; i++)
+			BoostAndStore(columns, i, ejectileE_cm, ejectileP_cm);
+	}
+
+#ifdef __AVX2__
+
+	//Same operations in the same order as BoostAndStore, four events at a time
+	static inline void BoostAndStore4(const TwoBodyColumns& columns, size_t i, __m256d ejectE_cm, __m256d ejectP_cm)
+	{
+		const __m256d one = _mm256_set1_pd(1.0);
+		const __m256d zero = _mm256_setzero_pd();
+
+		__m256d parentPx = _mm256_loadu_pd(columns.parentPx + i);
+		__m256d parentPy = _mm256_loadu_pd(columns.parentPy + i);
+		__m256d parentPz = _mm256_loadu_pd(columns.parentPz + i);
+		__m256d parentE = _mm256_loadu_pd(columns.parentE + i);
+		__m256d cmPx = _mm256_mul_pd(ejectP_cm, _mm256_loadu_pd(columns.directionX + i));
+		__m256d cmPy = _mm256_mul_pd(ejectP_cm, _mm256_loadu_pd(columns.directionY + i));
+		__m256d cmPz = _mm256_mul_pd(ejectP_cm, _mm256_loadu_pd(columns.directionZ + i));
+
+		__m256d bx = _mm256_div_pd(parentPx, parentE);
+		__m256d by = _mm256_div_pd(parentPy, parentE);
+		__m256d bz = _mm256_div_pd(parentPz, parentE);
+		__m256d b2 = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(bx, bx), _mm256_mul_pd(by, by)), _mm256_mul_pd(bz, bz));
+		__m256d gamma = _mm256_div_pd(one, _mm256_sqrt_pd(_mm256_sub_pd(one, b2)));
+		__m256d bp = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(bx, cmPx), _mm256_mul_pd(by, cmPy)), _mm256_mul_pd(bz, cmPz));
+		__m256d gamma2 = _mm256_blendv_pd(zero, _mm256_div_pd(_mm256_sub_pd(gamma, one), b2), _mm256_cmp_pd(b2, zero, _CMP_GT_OQ));
+		__m256d gamma2bp = _mm256_mul_pd(gamma2, bp);
+		__m256d gammaE = _mm256_mul_pd(gamma, ejectE_cm);
+		__m256d ejectPx = _mm256_add_pd(_mm256_add_pd(cmPx, _mm256_mul_pd(gamma2bp, bx)), _mm256_mul_pd(gammaE, bx));
+		__m256d ejectPy = _mm256_add_pd(_mm256_add_pd(cmPy, _mm256_mul_pd(gamma2bp, by)), _mm256_mul_pd(gammaE, by));
+		__m256d ejectPz = _mm256_add_pd(_mm256_add_pd(cmPz, _mm256_mul_pd(gamma2bp, bz)), _mm256_mul_pd(gammaE, bz));
+		__m256d ejectE = _mm256_mul_pd(gamma, _mm256_add_pd(ejectE_cm, bp));
+
+		_mm256_storeu_pd(columns.ejectilePx + i, ejectPx);
+		_mm256_storeu_pd(columns.ejectilePy + i, ejectPy);
+		_mm256_storeu_pd(columns.ejectilePz + i, ejectPz);
+		_mm256_storeu_pd(columns.ejectileE + i, ejectE);
+		_mm256_storeu_pd(columns.residualPx + i, _mm256_sub_pd(parentPx, ejectPx));
+		_mm256_storeu_pd(columns.residualPy + i, _mm256_sub_pd(parentPy, ejectPy));
+		_mm256_storeu_pd(columns.residualPz + i, _mm256_sub_pd(parentPz, ejectPz));
+		_mm256_storeu_pd(columns.residualE + i, _mm256_sub_pd(parentE, ejectE));
+	}
+
+	void CalculateTwoBody(const TwoBodyColumns& columns, double ejectileMass, double residualMass, size_t n)
+	{
+		const __m256d ejectMass2 = _mm256_set1_pd(ejectileMass*ejectileMass);
+		const __m256d residMass = _mm256_set1_pd(residualMass);
+		const __m256d two = _mm256_set1_pd(2.0);
+
+		size_t i = 0;
+		for(; i+4<=n; i+=4)
+		{
+			__m256d parentPx = _mm256_loadu_pd(columns.parentPx + i);
+			__m256d parentPy = _mm256_loadu_pd(columns.parentPy + i);
+			__m256d parentPz = _mm256_loadu_pd(columns.parentPz + i);
+			__m256d parentE = _mm256_loadu_pd(columns.parentE + i);
+			__m256d residM = columns.residualExcitation ? _mm256_add_pd(residMass, _mm256_loadu_pd(columns.residualExcitation + i)) : residMass;
+
+			__m256d parentP2 = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(parentPx, parentPx), _mm256_mul_pd(parentPy, parentPy)), _mm256_mul_pd(parentPz, parentPz));
+			__m256d parentM2 = _mm256_sub_pd(_mm256_mul_pd(parentE, parentE), parentP2);
+			__m256d parentM = _mm256_sqrt_pd(parentM2);
+			__m256d ejectE_cm = _mm256_div_pd(_mm256_add_pd(_mm256_sub_pd(ejectMass2, _mm256_mul_pd(residM, residM)), parentM2), _mm256_mul_pd(two, parentM));
+			__m256d ejectP_cm = _mm256_sqrt_pd(_mm256_sub_pd(_mm256_mul_pd(ejectE_cm, ejectE_cm), ejectMass2));
+			BoostAndStore4(columns, i, ejectE_cm, ejectP_cm);
+		}
+
+		CalculateTwoBodyScalar(columns, ejectileMass, residualMass, i, n);
+	}
+
+	void CalculateTwoBodyFixedCM(const TwoBodyColumns& columns, double ejectileE_cm, double ejectileP_cm, size_t n)
+	{
+		const __m256d ejectE_cm = _mm256_set1_pd(ejectileE_cm);
+		const __m256d ejectP_cm = _mm256_set1_pd(ejectileP_cm);
+		size_t i = 0;
+		for(; i+4<=n; i+=4)
+			BoostAndStore4(columns, i, ejectE_cm, ejectP_cm);
+
+		CalculateTwoBodyFixedCMScalar(columns, ejectileE_cm, ejectileP_cm, i, n);
+	}
+
+	bool IsTwoBodyKernelVectorized() { return true; }
+
+#else
+
+	void CalculateTwoBody(const TwoBodyColumns& columns, double ejectileMass, double residualMass, size_t n)
+	{
+		CalculateTwoBodyScalar(columns, ejectileMass, residualMass, 0, n);
+	}
+
+	void CalculateTwoBodyFixedCM(const TwoBodyColumns& columns, double ejectileE_cm, double ejectileP_cm, size_t n)
+	{
+		CalculateTwoBodyFixedCMScalar(columns, ejectileE_cm, ejectileP_cm, 0, n);
+	}
+
+	bool IsTwoBodyKernelVectorized() { return false; }
+
+#endif
+}
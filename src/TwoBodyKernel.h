@@ -0,0 +1,48 @@
+#ifndef TWO_BODY_KERNEL_H
+#define TWO_BODY_KERNEL_H
+
+#include <cstddef>
+
+namespace NucKage {
+
+	/*
+		Column pointers for the two-body kernel. Given a parent four-vector and a CM direction for the ejectile (unit vector),
+		the kernel writes the lab frame four-vectors of the ejectile and the residual. The residual columns may be the same
+		arrays as the parent columns (the parent is read before the residual is written).
+	*/
+	struct TwoBodyColumns
+	{
+		const double* parentPx = nullptr;
+		const double* parentPy = nullptr;
+		const double* parentPz = nullptr;
+		const double* parentE = nullptr;
+		const double* residualExcitation = nullptr; //nullptr means the residual is left in its ground state
+		const double* directionX = nullptr;
+		const double* directionY = nullptr;
+		const double* directionZ = nullptr;
+		double* ejectilePx = nullptr;
+		double* ejectilePy = nullptr;
+		double* ejectilePz = nullptr;
+		double* ejectileE = nullptr;
+		double* residualPx = nullptr;
+		double* residualPy = nullptr;
+		double* residualPz = nullptr;
+		double* residualE = nullptr;
+	};
+
+	/*
+		Events [0, n) are calculated. Uses AVX2 (four events per instruction) when built with AVX2 enabled (premake5 --avx2),
+		otherwise the scalar version. Events which are not kinematically allowed give meaningless (possibly NaN) values, the
+		caller is expected to have flagged them already.
+	*/
+	void CalculateTwoBody(const TwoBodyColumns& columns, double ejectileMass, double residualMass, size_t n);
+	//Same as CalculateTwoBody for a parent of fixed invariant mass: the CM energy and momentum of the ejectile are given, only the boost varies
+	void CalculateTwoBodyFixedCM(const TwoBodyColumns& columns, double ejectileE_cm, double ejectileP_cm, size_t n);
+	//Plain C++ versions of the kernels over events [first, last), also used for the remainder of the AVX2 loops
+	void CalculateTwoBodyScalar(const TwoBodyColumns& columns, double ejectileMass, double residualMass, size_t first, size_t last);
+	void CalculateTwoBodyFixedCMScalar(const TwoBodyColumns& columns, double ejectileE_cm, double ejectileP_cm, size_t first, size_t last);
+	//True when CalculateTwoBody was built with the AVX2 kernel
+	bool IsTwoBodyKernelVectorized();
+}
+
+#endif
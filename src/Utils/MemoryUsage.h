@@ -0,0 +1,30 @@
+#ifndef MEMORY_USAGE_H
+#define MEMORY_USAGE_H
+
+#include <cstdint>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace NucKage {
+
+	//Peak resident set size of the process in bytes, 0 if unavailable on this platform
+	inline uint64_t GetPeakResidentBytes()
+	{
+	#if defined(__unix__) || defined(__APPLE__)
+		struct rusage usage;
+		if(getrusage(RUSAGE_SELF, &usage) != 0)
+			return 0;
+		#if defined(__APPLE__)
+			return uint64_t(usage.ru_maxrss); //bytes on MacOS
+		#else
+			return uint64_t(usage.ru_maxrss)*1024; //kilobytes on Linux
+		#endif
+	#else
+		return 0;
+	#endif
+	}
+}
+
+#endif
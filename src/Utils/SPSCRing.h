@@ -0,0 +1,58 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <array>
+#include <cstddef>
+
+namespace NucKage {
+
+	/*
+		Fixed capacity, lock-free ring buffer for exactly one producer thread and one consumer thread.
+		The producer only ever writes m_tail and the consumer only ever writes m_head; each lives on
+		its own cache line so the two sides do not contend.
+	*/
+	template<typename T, size_t Capacity>
+	class SPSCRing
+	{
+	public:
+		static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SPSCRing capacity must be a power of two");
+
+		SPSCRing() :
+			m_head(0), m_tail(0)
+		{
+		}
+
+		//Producer side
+		bool TryPush(T&& item)
+		{
+			size_t tail = m_tail.load(std::memory_order_relaxed);
+			if(tail - m_head.load(std::memory_order_acquire) == Capacity)
+				return false;
+			m_buffer[tail & s_mask] = std::move(item);
+			m_tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		//Consumer side. The slot is reset, so nothing the item owned is kept alive by the ring.
+		bool TryPop(T& item)
+		{
+			size_t head = m_head.load(std::memory_order_relaxed);
+			if(head == m_tail.load(std::memory_order_acquire))
+				return false;
+			item = std::move(m_buffer[head & s_mask]);
+			m_buffer[head & s_mask] = T();
+			m_head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+	private:
+		static constexpr size_t s_mask = Capacity - 1;
+
+		alignas(64) std::atomic<size_t> m_head;
+		alignas(64) std::atomic<size_t> m_tail;
+		alignas(64) std::array<T, Capacity> m_buffer;
+	};
+}
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef VEC4_H
+#define VEC4_H
+
+#include <cmath>
+#include <type_traits>
+
+namespace NucKage {
+
+	/*
+		Plain three-vector and Lorentz four-vector for event data. Unlike the ROOT TVector3/TLorentzVector these are trivially
+		copyable (no vtable, no TObject), so events can be copied around and stored in blocks cheaply. The accessors follow the
+		ROOT names. ROOT types are only used at the output (histograms, graphs) and for the detector geometry.
+	*/
+	struct Vec3
+	{
+		Vec3() = default;
+		Vec3(double xIn, double yIn, double zIn) : x(xIn), y(yIn), z(zIn) {}
+
+		inline double X() const { return x; }
+		inline double Y() const { return y; }
+		inline double Z() const { return z; }
+		inline double Mag2() const { return x*x + y*y + z*z; }
+		inline double Mag() const { return std::sqrt(Mag2()); }
+		inline double Perp() const { return std::sqrt(x*x + y*y); }
+		inline double Theta() const { return x == 0.0 && y == 0.0 && z == 0.0 ? 0.0 : std::atan2(Perp(), z); }
+		inline double Phi() const { return x == 0.0 && y == 0.0 ? 0.0 : std::atan2(y, x); }
+		inline double Dot(const Vec3& other) const { return x*other.x + y*other.y + z*other.z; }
+
+		inline Vec3 operator-() const { return Vec3(-x, -y, -z); }
+		inline Vec3 operator+(const Vec3& other) const { return Vec3(x + other.x, y + other.y, z + other.z); }
+		inline Vec3 operator-(const Vec3& other) const { return Vec3(x - other.x, y - other.y, z - other.z); }
+
+		double x = 0.0;
+		double y = 0.0;
+		double z = 0.0;
+	};
+
+	inline Vec3 operator*(double scale, const Vec3& vec) { return Vec3(scale*vec.x, scale*vec.y, scale*vec.z); }
+	inline Vec3 operator*(const Vec3& vec, double scale) { return scale*vec; }
+
+	struct Vec4
+	{
+		Vec4() = default;
+		Vec4(double pxIn, double pyIn, double pzIn, double eIn) : px(pxIn), py(pyIn), pz(pzIn), e(eIn) {}
+
+		inline void SetPxPyPzE(double pxIn, double pyIn, double pzIn, double eIn) { px = pxIn; py = pyIn; pz = pzIn; e = eIn; }
+
+		inline double Px() const { return px; }
+		inline double Py() const { return py; }
+		inline double Pz() const { return pz; }
+		inline double E() const { return e; }
+		inline double P2() const { return px*px + py*py + pz*pz; }
+		inline double P() const { return std::sqrt(P2()); }
+		inline double M2() const { return e*e - P2(); }
+		//Negative for space-like vectors, as in ROOT
+		inline double M() const
+		{
+			double m2 = M2();
+			return m2 < 0.0 ? -std::sqrt(-m2) : std::sqrt(m2);
+		}
+		inline double KE() const { return e - M(); }
+		inline double Theta() const { return Vect().Theta(); }
+		inline double Phi() const { return Vect().Phi(); }
+		inline Vec3 Vect() const { return Vec3(px, py, pz); }
+		inline Vec3 BoostVector() const { return Vec3(px/e, py/e, pz/e); }
+
+		inline void Boost(double bx, double by, double bz)
+		{
+			double b2 = bx*bx + by*by + bz*bz;
+			double gamma = 1.0/std::sqrt(1.0 - b2);
+			double bp = bx*px + by*py + bz*pz;
+			double gamma2 = b2 > 0.0 ? (gamma - 1.0)/b2 : 0.0;
+			px += gamma2*bp*bx + gamma*bx*e;
+			py += gamma2*bp*by + gamma*by*e;
+			pz += gamma2*bp*bz + gamma*bz*e;
+			e = gamma*(e + bp);
+		}
+		inline void Boost(const Vec3& beta) { Boost(beta.x, beta.y, beta.z); }
+
+		inline Vec4 operator+(const Vec4& other) const { return Vec4(px + other.px, py + other.py, pz + other.pz, e + other.e); }
+		inline Vec4 operator-(const Vec4& other) const { return Vec4(px - other.px, py - other.py, pz - other.pz, e - other.e); }
+
+		double px = 0.0;
+		double py = 0.0;
+		double pz = 0.0;
+		double e = 0.0;
+	};
+
+	static_assert(std::is_trivially_copyable<Vec3>::value, "Vec3 must be trivially copyable");
+	static_assert(std::is_trivially_copyable<Vec4>::value, "Vec4 must be trivially copyable");
+}
+
+#endif
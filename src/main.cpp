@@ -1,12 +1,26 @@
 #include "Simulator.h"
 #include "Utils/Timer.h"
 #include "Tests/tests.h"
+#include <TROOT.h>
 
 int main(int argc, char** argv)
 {
 	if(false) //turn on/off testing
 	{
 		NucKage::EnergyLossTest();
+		NucKage::ThreadPoolTest();
+		NucKage::RandomGeneratorTest();
+		NucKage::TwoBodyKernelTest();
+		NucKage::StoppingTableTest();
+		NucKage::RangeTableTest();
+		NucKage::ElectronicStoppingTest();
+		NucKage::IntegratorTest();
+		NucKage::BatchEnergyLossTest();
+		NucKage::TargetThreadTest();
+		NucKage::ThinTargetTest();
+		NucKage::EnergyLossCacheTest();
+		NucKage::ProjectileHandleTest();
+		NucKage::MultiLayerTargetTest();
 		return 0;
 	}
 	
@@ -31,8 +45,9 @@ int main(int argc, char** argv)
 		return 1;
 	}
 
-	
-	
+	//Plot sets (histograms, graphs) are built on the worker threads, so ROOT has to be made thread safe before the pool starts
+	ROOT::EnableThreadSafety();
+
 	NucKage::Simulator* sim = NucKage::CreateSimulator(nthreads);
 	sim->LoadConfig(role);
 	NucKage::Timer stopwatch("WholeProgram");